@@ -0,0 +1,69 @@
+#include "BinarySearchTree/BinarySearchTree.h"
+#include "benchmark/benchmark.h"
+#include <cstdint>
+#include <random>
+#include <set>
+#include <vector>
+
+/*
+ * Every benchmark is a template instantiated once for "tree::BinarySearchTree"
+ * and once for "std::multiset", so the numbers of both can be compared side by
+ * side. The argument of each benchmark is the number of elements in the
+ * container. The tree is not self-balancing, so keys are inserted in random
+ * order. It has no lookup member function yet, so only insertion and
+ * traversal are measured.
+ */
+
+/// Sizes to run every benchmark with: 1e2, 1e3, ..., 1e7 elements.
+static void sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(10)->Range(100, 10'000'000);
+}
+
+/// Generates "count" pseudo-random keys.
+static std::vector<int> random_keys(size_t count) {
+  std::mt19937 generator(42);
+  std::vector<int> keys(count);
+  for (int &key : keys) {
+    key = static_cast<int>(generator() >> 1);
+  }
+  return keys;
+}
+
+/// Creates a container with the keys in "keys".
+template <class Container>
+static void fill(Container &container, const std::vector<int> &keys) {
+  for (int key : keys) {
+    container.insert(key);
+  }
+}
+
+template <class Container> static void BM_Insert(benchmark::State &state) {
+  std::vector<int> keys = random_keys(state.range(0));
+  for (auto _ : state) {
+    Container container;
+    fill(container, keys);
+    benchmark::DoNotOptimize(container.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Container> static void BM_Iterate(benchmark::State &state) {
+  std::vector<int> keys = random_keys(state.range(0));
+  Container container;
+  fill(container, keys);
+  for (auto _ : state) {
+    int64_t sum{0};
+    for (auto it = container.begin(); it != container.end(); ++it) {
+      sum += *it;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_Insert, tree::BinarySearchTree<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Insert, std::multiset<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, tree::BinarySearchTree<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, std::multiset<int>)->Apply(sizes);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,140 @@
+#include "Deque/Deque.h"
+#include "benchmark/benchmark.h"
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <vector>
+
+/*
+ * Every benchmark is a template instantiated once for "sc::deque" and once for
+ * "std::deque", so the numbers of both can be compared side by side. The
+ * argument of each benchmark is the number of elements in the container. The
+ * "push" and "iterate" benchmarks also run with blocks of 3 elements, the old
+ * default, to show the effect of the block size.
+ */
+
+/// sc::deque with the block size it had before being derived from sizeof(T).
+using small_blocks_deque = sc::deque<int, 3>;
+
+/// Sizes to run every benchmark with: 1e2, 1e3, ..., 1e7 elements.
+static void sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(10)->Range(100, 10'000'000);
+}
+
+/// Generates "count" pseudo-random indexes in the range [0, bound).
+static std::vector<size_t> random_indexes(size_t count, size_t bound) {
+  std::mt19937_64 generator(42);
+  std::uniform_int_distribution<size_t> distribution(0, bound - 1);
+  std::vector<size_t> indexes(count);
+  for (size_t &index : indexes) {
+    index = distribution(generator);
+  }
+  return indexes;
+}
+
+/// Creates a container with "size" elements.
+template <class Container> static Container filled(size_t size) {
+  Container container;
+  for (size_t index{0}; index < size; ++index) {
+    container.push_back(static_cast<int>(index));
+  }
+  return container;
+}
+
+template <class Container> static void BM_PushBack(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    Container container;
+    for (size_t index{0}; index < size; ++index) {
+      container.push_back(static_cast<int>(index));
+    }
+    benchmark::DoNotOptimize(container.back());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Container> static void BM_PushFront(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    Container container;
+    for (size_t index{0}; index < size; ++index) {
+      container.push_front(static_cast<int>(index));
+    }
+    benchmark::DoNotOptimize(container.front());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Container> static void BM_PopFront(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container container = filled<Container>(size);
+    state.ResumeTiming();
+    while (!container.empty()) {
+      container.pop_front();
+    }
+    benchmark::DoNotOptimize(container.empty());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Uses the container as a queue that always holds "size" elements.
+template <class Container> static void BM_Queue(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  Container container = filled<Container>(size);
+  int next{0};
+  for (auto _ : state) {
+    for (int counter{0}; counter < 1024; ++counter) {
+      container.push_back(next++);
+      container.pop_front();
+    }
+    benchmark::DoNotOptimize(container.front());
+  }
+  state.SetItemsProcessed(state.iterations() * 1024);
+}
+
+template <class Container> static void BM_Lookup(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  Container container = filled<Container>(size);
+  std::vector<size_t> indexes = random_indexes(1024, size);
+  for (auto _ : state) {
+    int sum{0};
+    for (size_t index : indexes) {
+      sum += container[index];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * indexes.size());
+}
+
+template <class Container> static void BM_Iterate(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  Container container = filled<Container>(size);
+  for (auto _ : state) {
+    int sum{0};
+    for (int value : container) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_PushBack, sc::deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushBack, std::deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushBack, small_blocks_deque)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushFront, sc::deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushFront, std::deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushFront, small_blocks_deque)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PopFront, sc::deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PopFront, std::deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Queue, sc::deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Queue, std::deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Lookup, sc::deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Lookup, std::deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, sc::deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, std::deque<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, small_blocks_deque)->Apply(sizes);
+
+BENCHMARK_MAIN();
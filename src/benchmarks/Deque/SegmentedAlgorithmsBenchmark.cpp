@@ -0,0 +1,93 @@
+#include "Deque/Deque.h"
+#include "Deque/SegmentedAlgorithms.h"
+#include "benchmark/benchmark.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/*
+ * Compares the segmented algorithms with the std ones over a sc::deque of
+ * int32_t, and with the std ones over a std::vector as the contiguous bound.
+ * The argument of each benchmark is the number of elements.
+ */
+
+/// Sizes to run every benchmark with, from L1 resident to memory bound.
+static void sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(10)->Range(1'000, 10'000'000);
+}
+
+/// Creates a container with the values [0, size).
+template <class Container> static Container filled(size_t size) {
+  Container container;
+  for (size_t index{0}; index < size; ++index) {
+    container.push_back(static_cast<int32_t>(index));
+  }
+  return container;
+}
+
+/// Which implementation of the algorithms a benchmark runs.
+enum class flavor { deque_std, deque_segmented, vector_std };
+
+template <flavor Flavor> static void BM_ForEach(benchmark::State &state) {
+  auto deque = filled<sc::deque<int32_t>>(state.range(0));
+  auto vector = filled<std::vector<int32_t>>(state.range(0));
+  for (auto _ : state) {
+    int64_t total{0};
+    auto add = [&total](int32_t value) { total += value; };
+    if constexpr (Flavor == flavor::deque_std) {
+      std::for_each(deque.begin(), deque.end(), add);
+    } else if constexpr (Flavor == flavor::deque_segmented) {
+      sc::segmented::for_each(deque.begin(), deque.end(), add);
+    } else {
+      std::for_each(vector.begin(), vector.end(), add);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_ForEach, flavor::deque_std)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_ForEach, flavor::deque_segmented)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_ForEach, flavor::vector_std)->Apply(sizes);
+
+template <flavor Flavor> static void BM_Copy(benchmark::State &state) {
+  auto deque = filled<sc::deque<int32_t>>(state.range(0));
+  auto vector = filled<std::vector<int32_t>>(state.range(0));
+  std::vector<int32_t> destiny(state.range(0));
+  for (auto _ : state) {
+    if constexpr (Flavor == flavor::deque_std) {
+      std::copy(deque.begin(), deque.end(), destiny.begin());
+    } else if constexpr (Flavor == flavor::deque_segmented) {
+      sc::segmented::copy(deque.begin(), deque.end(), destiny.begin());
+    } else {
+      std::copy(vector.begin(), vector.end(), destiny.begin());
+    }
+    benchmark::DoNotOptimize(destiny.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Copy, flavor::deque_std)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Copy, flavor::deque_segmented)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Copy, flavor::vector_std)->Apply(sizes);
+
+/// Searches for a value that is not present, so the whole range is scanned.
+template <flavor Flavor> static void BM_Find(benchmark::State &state) {
+  auto deque = filled<sc::deque<int32_t>>(state.range(0));
+  auto vector = filled<std::vector<int32_t>>(state.range(0));
+  for (auto _ : state) {
+    if constexpr (Flavor == flavor::deque_std) {
+      benchmark::DoNotOptimize(std::find(deque.begin(), deque.end(), -1));
+    } else if constexpr (Flavor == flavor::deque_segmented) {
+      benchmark::DoNotOptimize(
+          sc::segmented::find(deque.begin(), deque.end(), -1));
+    } else {
+      benchmark::DoNotOptimize(std::find(vector.begin(), vector.end(), -1));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Find, flavor::deque_std)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Find, flavor::deque_segmented)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Find, flavor::vector_std)->Apply(sizes);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,139 @@
+#include "Deque/WorkStealingDeque.h"
+#include "benchmark/benchmark.h"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * Recursive fork-join over the range [0, 2^22): a task splits its range in
+ * halves, forks the right one and goes on with the left one, until 1024
+ * elements are left, which it then hashes and sums. The tasks are scheduled
+ * with one sc::work_stealing_deque per thread, and, as the baseline, with a
+ * single std::deque shared by all threads behind a mutex. The argument is
+ * the number of threads; the times are wall clock ones.
+ */
+
+/// Number of elements the work is made of.
+constexpr uint64_t total{1 << 22};
+/// Number of elements a task stops splitting at.
+constexpr uint64_t leaf{1024};
+
+/// Numbers of threads to run every benchmark with.
+static void threads(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(2)->Range(1, 8);
+  benchmark->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+/// A task is a range of elements, with "begin" in the upper half.
+static uint64_t make_task(uint64_t begin, uint64_t end) {
+  return begin << 32 | end;
+}
+
+/// Work done for every element.
+static uint64_t hash(uint64_t value) {
+  value ^= value >> 33;
+  value *= 0xff51afd7ed558ccdULL;
+  value ^= value >> 33;
+  return value;
+}
+
+/// One work-stealing deque per thread, the thieves visit the others in turn.
+class stealing_pool {
+public:
+  explicit stealing_pool(size_t size) {
+    for (size_t index{0}; index < size; ++index) {
+      m_deques.push_back(std::make_unique<sc::work_stealing_deque<uint64_t>>());
+    }
+  }
+  void push(size_t self, uint64_t task) { m_deques[self]->push_back(task); }
+  bool take(size_t self, uint64_t &task) {
+    if (m_deques[self]->pop_back(task)) {
+      return true;
+    }
+    for (size_t offset{1}; offset < m_deques.size(); ++offset) {
+      if (m_deques[(self + offset) % m_deques.size()]->steal(task)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  std::vector<std::unique_ptr<sc::work_stealing_deque<uint64_t>>> m_deques;
+};
+
+/// A single deque of tasks behind a mutex, used as a stack by every thread.
+class locked_pool {
+public:
+  explicit locked_pool(size_t /* size */) {}
+  void push(size_t /* self */, uint64_t task) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tasks.push_back(task);
+  }
+  bool take(size_t /* self */, uint64_t &task) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_tasks.empty()) {
+      return false;
+    }
+    task = m_tasks.back();
+    m_tasks.pop_back();
+    return true;
+  }
+
+private:
+  std::mutex m_mutex;
+  std::deque<uint64_t> m_tasks;
+};
+
+/// Runs tasks of "pool" as thread "self" until every element is processed.
+template <typename Pool>
+static uint64_t work(Pool &pool, size_t self, std::atomic<uint64_t> &left) {
+  uint64_t sum{0};
+  uint64_t task{0};
+  while (left.load(std::memory_order_acquire) > 0) {
+    if (!pool.take(self, task)) {
+      std::this_thread::yield();
+      continue;
+    }
+    uint64_t begin = task >> 32;
+    uint64_t end = task & 0xffffffffULL;
+    while (end - begin > leaf) {
+      uint64_t middle = begin + (end - begin) / 2;
+      pool.push(self, make_task(middle, end));
+      end = middle;
+    }
+    for (uint64_t index{begin}; index < end; ++index) {
+      sum += hash(index);
+    }
+    left.fetch_sub(end - begin, std::memory_order_release);
+  }
+  return sum;
+}
+
+template <typename Pool> static void BM_ForkJoin(benchmark::State &state) {
+  const auto count = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    Pool pool(count);
+    std::atomic<uint64_t> left{total};
+    pool.push(0, make_task(0, total));
+    std::vector<std::thread> workers;
+    for (size_t self{1}; self < count; ++self) {
+      workers.emplace_back([&pool, &left, self] {
+        benchmark::DoNotOptimize(work(pool, self, left));
+      });
+    }
+    benchmark::DoNotOptimize(work(pool, 0, left));
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * total);
+}
+BENCHMARK_TEMPLATE(BM_ForkJoin, locked_pool)->Apply(threads);
+BENCHMARK_TEMPLATE(BM_ForkJoin, stealing_pool)->Apply(threads);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,103 @@
+#include "HashTable/HashTableSeparateChaining.h"
+#include "benchmark/benchmark.h"
+#include <cstdint>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+/*
+ * Every benchmark is a template instantiated once for "ac::HashTable" and once
+ * for "std::unordered_set", so the numbers of both can be compared side by
+ * side. The argument of each benchmark is the number of keys in the container.
+ */
+
+/// Sizes to run every benchmark with: 1e2, 1e3, ..., 1e7 elements.
+static void sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(10)->Range(100, 10'000'000);
+}
+
+/// Generates "count" pseudo-random keys.
+static std::vector<int64_t> random_keys(size_t count) {
+  std::mt19937_64 generator(42);
+  std::vector<int64_t> keys(count);
+  for (int64_t &key : keys) {
+    key = static_cast<int64_t>(generator() >> 1);
+  }
+  return keys;
+}
+
+/// Creates a container with the keys in "keys".
+template <class Container>
+static Container filled(const std::vector<int64_t> &keys) {
+  Container container;
+  for (int64_t key : keys) {
+    container.insert(key);
+  }
+  return container;
+}
+
+template <class Container> static void BM_Insert(benchmark::State &state) {
+  std::vector<int64_t> keys = random_keys(state.range(0));
+  for (auto _ : state) {
+    Container container = filled<Container>(keys);
+    benchmark::DoNotOptimize(container.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Container> static void BM_Erase(benchmark::State &state) {
+  std::vector<int64_t> keys = random_keys(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container container = filled<Container>(keys);
+    state.ResumeTiming();
+    for (int64_t key : keys) {
+      container.erase(key);
+    }
+    benchmark::DoNotOptimize(container.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Looks up 1024 keys, half of them present in the container.
+template <class Container> static void BM_Lookup(benchmark::State &state) {
+  std::vector<int64_t> keys = random_keys(state.range(0));
+  Container container = filled<Container>(keys);
+  std::vector<int64_t> queries;
+  for (size_t index{0}; index < 1024; ++index) {
+    queries.push_back(index % 2 == 0 ? keys[index % keys.size()]
+                                     : -static_cast<int64_t>(index));
+  }
+  for (auto _ : state) {
+    size_t found{0};
+    for (int64_t key : queries) {
+      found += container.count(key);
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * queries.size());
+}
+
+template <class Container> static void BM_Iterate(benchmark::State &state) {
+  std::vector<int64_t> keys = random_keys(state.range(0));
+  Container container = filled<Container>(keys);
+  for (auto _ : state) {
+    int64_t sum{0};
+    for (auto it = container.begin(); it != container.end(); ++it) {
+      sum += *it;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_Insert, ac::HashTable<int64_t>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Insert, std::unordered_set<int64_t>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Erase, ac::HashTable<int64_t>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Erase, std::unordered_set<int64_t>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Lookup, ac::HashTable<int64_t>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Lookup, std::unordered_set<int64_t>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, ac::HashTable<int64_t>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, std::unordered_set<int64_t>)->Apply(sizes);
+
+BENCHMARK_MAIN();
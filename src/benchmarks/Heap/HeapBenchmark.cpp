@@ -0,0 +1,82 @@
+#include "Heap/Heap.h"
+#include "benchmark/benchmark.h"
+#include <cstdint>
+#include <queue>
+#include <random>
+#include <vector>
+
+/*
+ * Every benchmark is a template instantiated once for "tree::Heap" and once for
+ * "std::priority_queue", so the numbers of both can be compared side by side.
+ * The argument of each benchmark is the number of elements in the container.
+ */
+
+/// Sizes to run every benchmark with: 1e2, 1e3, ..., 1e7 elements.
+static void sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(10)->Range(100, 10'000'000);
+}
+
+/// Generates "count" pseudo-random values.
+static std::vector<int> random_values(size_t count) {
+  std::mt19937 generator(42);
+  std::vector<int> values(count);
+  for (int &value : values) {
+    value = static_cast<int>(generator() >> 1);
+  }
+  return values;
+}
+
+/// Creates a container with the values in "values".
+template <class Container>
+static Container filled(const std::vector<int> &values) {
+  Container container;
+  for (int value : values) {
+    container.push(value);
+  }
+  return container;
+}
+
+template <class Container> static void BM_Push(benchmark::State &state) {
+  std::vector<int> values = random_values(state.range(0));
+  for (auto _ : state) {
+    Container container = filled<Container>(values);
+    benchmark::DoNotOptimize(container.top());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Container> static void BM_Pop(benchmark::State &state) {
+  std::vector<int> values = random_values(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container container = filled<Container>(values);
+    state.ResumeTiming();
+    while (!container.empty()) {
+      container.pop();
+    }
+    benchmark::DoNotOptimize(container.empty());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Pushes and pops one element, keeping the size of the container constant.
+template <class Container> static void BM_PushPop(benchmark::State &state) {
+  std::vector<int> values = random_values(state.range(0));
+  Container container = filled<Container>(values);
+  size_t index{0};
+  for (auto _ : state) {
+    container.push(values[index++ % values.size()]);
+    container.pop();
+    benchmark::DoNotOptimize(container.top());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_Push, tree::Heap<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Push, std::priority_queue<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Pop, tree::Heap<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Pop, std::priority_queue<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushPop, tree::Heap<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushPop, std::priority_queue<int>)->Apply(sizes);
+
+BENCHMARK_MAIN();
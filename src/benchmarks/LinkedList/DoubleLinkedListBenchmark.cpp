@@ -0,0 +1,79 @@
+#include "LinkedList/DoubleLinkedList.h"
+#include "benchmark/benchmark.h"
+#include <cstdint>
+#include <list>
+
+/*
+ * Every benchmark is a template instantiated once for "sc::list" and once for
+ * "std::list", so the numbers of both can be compared side by side. The
+ * argument of each benchmark is the number of elements in the container.
+ */
+
+/// Sizes to run every benchmark with: 1e2, 1e3, ..., 1e7 elements.
+static void sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(10)->Range(100, 10'000'000);
+}
+
+template <class Container> static void BM_PushBack(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    Container container;
+    for (size_t index{0}; index < size; ++index) {
+      container.push_back(static_cast<int>(index));
+    }
+    benchmark::DoNotOptimize(container.back());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Container> static void BM_PopFront(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container container(size, 7);
+    state.ResumeTiming();
+    while (!container.empty()) {
+      container.pop_front();
+    }
+    benchmark::DoNotOptimize(container.empty());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Linear search for an element that is not in the container.
+template <class Container> static void BM_Lookup(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  Container container(size, 7);
+  for (auto _ : state) {
+    auto it = container.begin();
+    while (it != container.end() && *it != 8) {
+      ++it;
+    }
+    benchmark::DoNotOptimize(it);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Container> static void BM_Iterate(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  Container container(size, 7);
+  for (auto _ : state) {
+    int sum{0};
+    for (int value : container) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_PushBack, sc::list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushBack, std::list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PopFront, sc::list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PopFront, std::list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Lookup, sc::list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Lookup, std::list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, sc::list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, std::list<int>)->Apply(sizes);
+
+BENCHMARK_MAIN();
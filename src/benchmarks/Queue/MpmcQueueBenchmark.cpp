@@ -0,0 +1,111 @@
+#include "Queue/MpmcQueue.h"
+#include "Queue/Queue.h"
+#include "benchmark/benchmark.h"
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * Hands 2^20 int64_t values from producer threads to consumer threads through
+ * sc::mpmc_queue, and through a sc::queue guarded by a mutex as the baseline.
+ * The argument is the number of threads: half of them produce and half of
+ * them consume, while a single thread alternates bursts of pushes and pops,
+ * which measures the queue with no contention. The times are wall clock ones.
+ */
+
+/// Number of values handed over in each iteration.
+constexpr int64_t total{1 << 20};
+
+/// Numbers of threads to run every benchmark with.
+static void threads(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(2)->Range(1, 32);
+  benchmark->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+/// sc::queue behind a mutex, bounded and blocking like mpmc_queue.
+class locked_queue {
+public:
+  bool try_push(int64_t value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_size == 1024) {
+      return false;
+    }
+    m_queue.push(value);
+    ++m_size;
+    return true;
+  }
+  bool try_pop(int64_t &value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_size == 0) {
+      return false;
+    }
+    value = m_queue.front();
+    m_queue.pop();
+    --m_size;
+    return true;
+  }
+  void push(int64_t value) {
+    while (!try_push(value)) {
+      std::this_thread::yield();
+    }
+  }
+  void pop(int64_t &value) {
+    while (!try_pop(value)) {
+      std::this_thread::yield();
+    }
+  }
+
+private:
+  std::mutex m_mutex;
+  sc::queue<int64_t> m_queue;
+  size_t m_size{0};
+};
+
+using mpmc = sc::mpmc_queue<int64_t, 1024>;
+
+template <typename Queue> static void BM_Transfer(benchmark::State &state) {
+  const int64_t count = state.range(0);
+  for (auto _ : state) {
+    Queue queue;
+    int64_t value{0};
+    if (count == 1) {
+      for (int64_t sent{0}; sent < total; sent += 512) {
+        for (int64_t index{0}; index < 512; ++index) {
+          queue.push(sent + index);
+        }
+        for (int64_t index{0}; index < 512; ++index) {
+          queue.pop(value);
+        }
+      }
+      benchmark::DoNotOptimize(value);
+      continue;
+    }
+    std::vector<std::thread> workers;
+    const int64_t share = total / (count / 2);
+    for (int64_t producer{0}; producer < count / 2; ++producer) {
+      workers.emplace_back([&queue, share] {
+        for (int64_t index{0}; index < share; ++index) {
+          queue.push(index);
+        }
+      });
+      workers.emplace_back([&queue, share] {
+        int64_t sum{0};
+        int64_t received{0};
+        for (int64_t index{0}; index < share; ++index) {
+          queue.pop(received);
+          sum += received;
+        }
+        benchmark::DoNotOptimize(sum);
+      });
+    }
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * total);
+}
+BENCHMARK_TEMPLATE(BM_Transfer, locked_queue)->Apply(threads);
+BENCHMARK_TEMPLATE(BM_Transfer, mpmc)->Apply(threads);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,96 @@
+#include "Deque/Deque.h"
+#include "Queue/Queue.h"
+#include "benchmark/benchmark.h"
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+/*
+ * Moves 2^16 int64_t values through sc::queue in batches: each batch is
+ * pushed and then popped, either one element per call with push, front and
+ * pop, or with a single push_range and a single pop_n, or drain. The argument
+ * is the batch size, so the items per second show the cost per element as the
+ * batches grow. The queues over std::deque, the default, and over sc::deque
+ * are measured.
+ */
+
+/// Number of values moved through the queue in each iteration.
+constexpr int64_t total{1 << 16};
+
+using std_deque_queue = sc::queue<int64_t>;
+using sc_deque_queue = sc::queue<int64_t, sc::deque<int64_t>>;
+
+/// Batch sizes to run every benchmark with.
+static void batches(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(4)->Range(1, 1024);
+}
+
+/// Pushes and pops every element of a batch with a call per element.
+template <typename Queue> static void BM_OneByOne(benchmark::State &state) {
+  const int64_t batch = state.range(0);
+  Queue queue;
+  for (auto _ : state) {
+    int64_t sum{0};
+    for (int64_t sent{0}; sent < total; sent += batch) {
+      for (int64_t index{0}; index < batch; ++index) {
+        queue.push(sent + index);
+      }
+      for (int64_t index{0}; index < batch; ++index) {
+        sum += queue.front();
+        queue.pop();
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * total);
+}
+BENCHMARK_TEMPLATE(BM_OneByOne, std_deque_queue)->Apply(batches);
+BENCHMARK_TEMPLATE(BM_OneByOne, sc_deque_queue)->Apply(batches);
+
+/// Pushes every batch with push_range and pops it with pop_n.
+template <typename Queue> static void BM_Batch(benchmark::State &state) {
+  const int64_t batch = state.range(0);
+  std::vector<int64_t> input(batch);
+  std::vector<int64_t> output(batch);
+  Queue queue;
+  for (auto _ : state) {
+    int64_t sum{0};
+    for (int64_t sent{0}; sent < total; sent += batch) {
+      for (int64_t index{0}; index < batch; ++index) {
+        input[index] = sent + index;
+      }
+      queue.push_range(input.begin(), input.end());
+      queue.pop_n(output.begin(), batch);
+      for (int64_t value : output) {
+        sum += value;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * total);
+}
+BENCHMARK_TEMPLATE(BM_Batch, std_deque_queue)->Apply(batches);
+BENCHMARK_TEMPLATE(BM_Batch, sc_deque_queue)->Apply(batches);
+
+/// Pushes every batch with push_range and consumes it with drain.
+template <typename Queue> static void BM_Drain(benchmark::State &state) {
+  const int64_t batch = state.range(0);
+  std::vector<int64_t> input(batch);
+  Queue queue;
+  for (auto _ : state) {
+    int64_t sum{0};
+    for (int64_t sent{0}; sent < total; sent += batch) {
+      for (int64_t index{0}; index < batch; ++index) {
+        input[index] = sent + index;
+      }
+      queue.push_range(input.begin(), input.end());
+      queue.drain([&sum](int64_t value) { sum += value; });
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * total);
+}
+BENCHMARK_TEMPLATE(BM_Drain, std_deque_queue)->Apply(batches);
+BENCHMARK_TEMPLATE(BM_Drain, sc_deque_queue)->Apply(batches);
+
+BENCHMARK_MAIN();
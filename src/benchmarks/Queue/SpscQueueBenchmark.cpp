@@ -0,0 +1,179 @@
+#include "Queue/Queue.h"
+#include "Queue/SpscQueue.h"
+#include "benchmark/benchmark.h"
+#include <cstdint>
+#include <mutex>
+#include <pthread.h>
+#include <thread>
+#include <vector>
+
+/*
+ * Hands int64_t values from a producer thread to a consumer thread through
+ * sc::spsc_queue, and through a sc::queue guarded by a mutex as the baseline.
+ * The producer is pinned to the first CPU and the consumer to the second one,
+ * when there are two. The argument of the throughput benchmarks is the number
+ * of values handed over in each iteration, the latency one reports the time
+ * of a round trip of a single value through two queues.
+ */
+
+/// Pins the calling thread to "cpu", if the machine has such CPU.
+static void pin_to(unsigned cpu) {
+  if (cpu >= std::thread::hardware_concurrency()) {
+    return;
+  }
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+/// Unpins the calling thread, so that the next benchmark starts clean.
+static void unpin() {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (unsigned cpu{0}; cpu < std::thread::hardware_concurrency(); ++cpu) {
+    CPU_SET(cpu, &set);
+  }
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+/// sc::queue behind a mutex, with the non-blocking interface of spsc_queue.
+class locked_queue {
+public:
+  bool try_push(int64_t value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_size == 1024) {
+      return false;
+    }
+    m_queue.push(value);
+    ++m_size;
+    return true;
+  }
+  bool try_pop(int64_t &value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_size == 0) {
+      return false;
+    }
+    value = m_queue.front();
+    m_queue.pop();
+    --m_size;
+    return true;
+  }
+
+private:
+  std::mutex m_mutex;
+  sc::queue<int64_t> m_queue;
+  size_t m_size{0};
+};
+
+using spsc = sc::spsc_queue<int64_t, 1024>;
+
+template <typename Queue> static void BM_Throughput(benchmark::State &state) {
+  const int64_t total = state.range(0);
+  pin_to(1);
+  for (auto _ : state) {
+    Queue queue;
+    std::thread producer([&queue, total] {
+      pin_to(0);
+      for (int64_t value{0}; value < total; ++value) {
+        while (!queue.try_push(value)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+    int64_t sum{0};
+    int64_t value{0};
+    for (int64_t received{0}; received < total;) {
+      if (queue.try_pop(value)) {
+        sum += value;
+        ++received;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+    producer.join();
+    benchmark::DoNotOptimize(sum);
+  }
+  unpin();
+  state.SetItemsProcessed(state.iterations() * total);
+}
+BENCHMARK_TEMPLATE(BM_Throughput, locked_queue)
+    ->Arg(1'000'000)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Throughput, spsc)->Arg(1'000'000)->UseRealTime();
+
+/// Same as BM_Throughput, moving the values in batches of 64.
+static void BM_ThroughputBatch(benchmark::State &state) {
+  const int64_t total = state.range(0);
+  pin_to(1);
+  for (auto _ : state) {
+    spsc queue;
+    std::thread producer([&queue, total] {
+      pin_to(0);
+      std::vector<int64_t> batch(64);
+      for (int64_t value{0}; value < total;) {
+        for (auto &element : batch) {
+          element = value++;
+        }
+        auto first = batch.cbegin();
+        while ((first = queue.try_push(first, batch.cend())) != batch.cend()) {
+          std::this_thread::yield();
+        }
+      }
+    });
+    std::vector<int64_t> batch(64);
+    int64_t sum{0};
+    for (int64_t received{0}; received < total;) {
+      size_t count = queue.try_pop(batch.begin(), batch.size());
+      if (count == 0) {
+        std::this_thread::yield();
+      }
+      for (size_t index{0}; index < count; ++index) {
+        sum += batch[index];
+      }
+      received += count;
+    }
+    producer.join();
+    benchmark::DoNotOptimize(sum);
+  }
+  unpin();
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ThroughputBatch)->Arg(1'024'000)->UseRealTime();
+
+/// Sends a value to the other thread and waits for it to come back.
+template <typename Queue> static void BM_RoundTrip(benchmark::State &state) {
+  Queue request;
+  Queue response;
+  pin_to(1);
+  std::thread echo([&request, &response] {
+    pin_to(0);
+    int64_t value{0};
+    do {
+      while (!request.try_pop(value)) {
+        std::this_thread::yield();
+      }
+      while (!response.try_push(value)) {
+        std::this_thread::yield();
+      }
+    } while (value >= 0);
+  });
+  int64_t value{0};
+  for (auto _ : state) {
+    request.try_push(value);
+    while (!response.try_pop(value)) {
+      std::this_thread::yield();
+    }
+    ++value;
+  }
+  request.try_push(-1);
+  while (!response.try_pop(value)) {
+    std::this_thread::yield();
+  }
+  echo.join();
+  unpin();
+}
+BENCHMARK_TEMPLATE(BM_RoundTrip, locked_queue)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RoundTrip, spsc)->UseRealTime();
+
+BENCHMARK_MAIN();
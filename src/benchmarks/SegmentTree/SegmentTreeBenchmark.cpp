@@ -0,0 +1,92 @@
+#include "SegmentTree/SegmentTree.h"
+#include "benchmark/benchmark.h"
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+/*
+ * There is no segment tree in "std", so "tree::SegmentTree" is compared against
+ * a plain "std::vector" that answers queries with "std::accumulate". The
+ * argument of each benchmark is the number of elements in the container.
+ */
+
+/// Sizes to run every benchmark with: 1e2, 1e3, ..., 1e7 elements.
+static void sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(10)->Range(100, 10'000'000);
+}
+
+/// Naive range sum over a vector, used as the baseline.
+class VectorSum {
+public:
+  VectorSum(const std::vector<int64_t> &list, int64_t) : m_list(list) {}
+  int64_t query(size_t interval_begin, size_t interval_end) {
+    return std::accumulate(m_list.begin() + interval_begin,
+                           m_list.begin() + interval_end, int64_t{0});
+  }
+  void update(size_t position, int64_t value) { m_list[position] = value; }
+
+private:
+  std::vector<int64_t> m_list;
+};
+
+using SumTree = tree::SegmentTree<int64_t, operations::Sum<int64_t>>;
+
+/// Generates "count" pseudo-random intervals in the range [0, bound).
+static std::vector<std::pair<size_t, size_t>> random_intervals(size_t count,
+                                                               size_t bound) {
+  std::mt19937_64 generator(42);
+  std::uniform_int_distribution<size_t> distribution(0, bound - 1);
+  std::vector<std::pair<size_t, size_t>> intervals(count);
+  for (auto &interval : intervals) {
+    size_t first = distribution(generator), second = distribution(generator);
+    interval = {std::min(first, second), std::max(first, second) + 1};
+  }
+  return intervals;
+}
+
+template <class Container> static void BM_Build(benchmark::State &state) {
+  std::vector<int64_t> list(state.range(0), 7);
+  for (auto _ : state) {
+    Container container(list, 0);
+    benchmark::DoNotOptimize(container.query(0, 1));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Container> static void BM_Query(benchmark::State &state) {
+  std::vector<int64_t> list(state.range(0), 7);
+  Container container(list, 0);
+  auto intervals = random_intervals(64, list.size());
+  for (auto _ : state) {
+    int64_t sum{0};
+    for (auto [first, last] : intervals) {
+      sum += container.query(first, last);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * intervals.size());
+}
+
+template <class Container> static void BM_Update(benchmark::State &state) {
+  std::vector<int64_t> list(state.range(0), 7);
+  Container container(list, 0);
+  auto intervals = random_intervals(1024, list.size());
+  for (auto _ : state) {
+    for (auto [position, value] : intervals) {
+      container.update(position, static_cast<int64_t>(value));
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * intervals.size());
+}
+
+BENCHMARK_TEMPLATE(BM_Build, SumTree)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Build, VectorSum)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Query, SumTree)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Query, VectorSum)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Update, SumTree)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Update, VectorSum)->Apply(sizes);
+
+BENCHMARK_MAIN();
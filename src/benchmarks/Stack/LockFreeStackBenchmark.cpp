@@ -0,0 +1,82 @@
+#include "Stack/LockFreeStack.h"
+#include "Stack/Stack.h"
+#include "benchmark/benchmark.h"
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * Uses sc::lock_free_stack, and a sc::stack guarded by a mutex as the
+ * baseline, as a free list shared by every thread: the list starts with 1024
+ * values, and each thread takes one and gives it back 2^20 / threads times,
+ * so that every iteration does 2^20 pairs of pop and push in total. The
+ * argument is the number of threads, and the times are wall clock ones.
+ */
+
+/// Number of pairs of pop and push in each iteration.
+constexpr int64_t total{1 << 20};
+
+/// Numbers of threads to run every benchmark with.
+static void threads(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(2)->Range(1, 32);
+  benchmark->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+/// sc::stack behind a mutex, with the interface of lock_free_stack.
+class locked_stack {
+public:
+  void push(int64_t value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stack.push(value);
+  }
+  bool try_pop(int64_t &value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_stack.empty()) {
+      return false;
+    }
+    value = m_stack.top();
+    m_stack.pop();
+    return true;
+  }
+
+private:
+  std::mutex m_mutex;
+  sc::stack<int64_t> m_stack;
+};
+
+using lock_free = sc::lock_free_stack<int64_t>;
+
+template <typename Stack> static void BM_FreeList(benchmark::State &state) {
+  const int64_t count = state.range(0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    Stack stack;
+    for (int64_t value{0}; value < 1024; ++value) {
+      stack.push(value);
+    }
+    state.ResumeTiming();
+    std::vector<std::thread> workers;
+    for (int64_t worker{0}; worker < count; ++worker) {
+      workers.emplace_back([&stack, count] {
+        int64_t value{0};
+        int64_t sum{0};
+        for (int64_t round{0}; round < total / count; ++round) {
+          if (stack.try_pop(value)) {
+            sum += value;
+            stack.push(value);
+          }
+        }
+        benchmark::DoNotOptimize(sum);
+      });
+    }
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * total);
+}
+BENCHMARK_TEMPLATE(BM_FreeList, locked_stack)->Apply(threads);
+BENCHMARK_TEMPLATE(BM_FreeList, lock_free)->Apply(threads);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,156 @@
+#include "Stack/Stack.h"
+#include "Stack/StaticStack.h"
+#include "benchmark/benchmark.h"
+#include <cstdint>
+#include <deque>
+#include <stack>
+#include <vector>
+
+/*
+ * Compares sc::stack over its default container, sc::vector, with sc::stack
+ * over std::deque, its previous default, and with std::stack. The argument of
+ * each benchmark is the number of elements pushed and popped per iteration;
+ * the stacks are created once, so the numbers are the cost of push and pop
+ * after warm up. The depth first search, whose stack stays shallow, also runs
+ * with sc::static_stack. The batch benchmarks compare moving elements one per
+ * call with push_range, pop_n and drain.
+ */
+
+using vector_stack = sc::stack<int64_t>;
+using deque_stack = sc::stack<int64_t, std::deque<int64_t>>;
+using std_stack = std::stack<int64_t>;
+using static_stack = sc::static_stack<int64_t, 64>;
+
+/// Sizes to run every benchmark with.
+static void sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(10)->Range(1'000, 1'000'000);
+}
+
+/// Pushes all the elements, then pops them all.
+template <typename Stack> static void BM_PushPop(benchmark::State &state) {
+  Stack stack;
+  for (auto _ : state) {
+    for (int64_t index{0}; index < state.range(0); ++index) {
+      stack.push(index);
+    }
+    int64_t total{0};
+    while (!stack.empty()) {
+      total += stack.top();
+      stack.pop();
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_PushPop, vector_stack)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushPop, deque_stack)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushPop, std_stack)->Apply(sizes);
+
+/*
+ * Depth first search over an implicit complete binary tree, where the
+ * children of node n are 2n + 1 and 2n + 2. The stack stays shallow and every
+ * pop is followed by up to two pushes, as in a DFS loop.
+ */
+template <typename Stack> static void BM_Dfs(benchmark::State &state) {
+  const int64_t nodes = state.range(0);
+  Stack stack;
+  for (auto _ : state) {
+    int64_t total{0};
+    stack.push(0);
+    while (!stack.empty()) {
+      int64_t node = stack.top();
+      stack.pop();
+      total += node;
+      if (2 * node + 2 < nodes) {
+        stack.push(2 * node + 2);
+      }
+      if (2 * node + 1 < nodes) {
+        stack.push(2 * node + 1);
+      }
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * nodes);
+}
+BENCHMARK_TEMPLATE(BM_Dfs, vector_stack)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Dfs, deque_stack)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Dfs, std_stack)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Dfs, static_stack)->Apply(sizes);
+
+/// Number of values moved through the stack in each batch benchmark iteration.
+constexpr int64_t total{1 << 16};
+
+/// Batch sizes to run every batch benchmark with.
+static void batches(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(4)->Range(1, 1024);
+}
+
+/// Pushes and pops every element of a batch with a call per element.
+template <typename Stack> static void BM_OneByOne(benchmark::State &state) {
+  const int64_t batch = state.range(0);
+  Stack stack;
+  for (auto _ : state) {
+    int64_t sum{0};
+    for (int64_t sent{0}; sent < total; sent += batch) {
+      for (int64_t index{0}; index < batch; ++index) {
+        stack.push(sent + index);
+      }
+      for (int64_t index{0}; index < batch; ++index) {
+        sum += stack.top();
+        stack.pop();
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * total);
+}
+BENCHMARK_TEMPLATE(BM_OneByOne, vector_stack)->Apply(batches);
+BENCHMARK_TEMPLATE(BM_OneByOne, deque_stack)->Apply(batches);
+
+/// Pushes every batch with push_range and pops it with pop_n.
+template <typename Stack> static void BM_Batch(benchmark::State &state) {
+  const int64_t batch = state.range(0);
+  std::vector<int64_t> input(batch);
+  std::vector<int64_t> output(batch);
+  Stack stack;
+  for (auto _ : state) {
+    int64_t sum{0};
+    for (int64_t sent{0}; sent < total; sent += batch) {
+      for (int64_t index{0}; index < batch; ++index) {
+        input[index] = sent + index;
+      }
+      stack.push_range(input.begin(), input.end());
+      stack.pop_n(output.begin(), batch);
+      for (int64_t value : output) {
+        sum += value;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * total);
+}
+BENCHMARK_TEMPLATE(BM_Batch, vector_stack)->Apply(batches);
+BENCHMARK_TEMPLATE(BM_Batch, deque_stack)->Apply(batches);
+
+/// Pushes every batch with push_range and consumes it with drain.
+template <typename Stack> static void BM_Drain(benchmark::State &state) {
+  const int64_t batch = state.range(0);
+  std::vector<int64_t> input(batch);
+  Stack stack;
+  for (auto _ : state) {
+    int64_t sum{0};
+    for (int64_t sent{0}; sent < total; sent += batch) {
+      for (int64_t index{0}; index < batch; ++index) {
+        input[index] = sent + index;
+      }
+      stack.push_range(input.begin(), input.end());
+      stack.drain([&sum](int64_t value) { sum += value; });
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * total);
+}
+BENCHMARK_TEMPLATE(BM_Drain, vector_stack)->Apply(batches);
+BENCHMARK_TEMPLATE(BM_Drain, deque_stack)->Apply(batches);
+
+BENCHMARK_MAIN();
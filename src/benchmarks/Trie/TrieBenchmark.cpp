@@ -0,0 +1,115 @@
+#include "Trie/Trie.h"
+#include "benchmark/benchmark.h"
+#include <cstdint>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+/*
+ * Every benchmark is instantiated once for "tree::Trie" and once for
+ * "std::multiset<std::string>", so the numbers of both can be compared side by
+ * side. The argument of each benchmark is the number of words in the
+ * container. Every node of the trie holds a "std::map", so sizes stop at 1e6
+ * words, 1e7 words would not fit in the memory of most machines.
+ */
+
+/// Sizes to run every benchmark with: 1e2, 1e3, ..., 1e6 words.
+static void sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(10)->Range(100, 1'000'000);
+}
+
+/// Generates "count" pseudo-random lowercase words with 4 to 12 letters.
+static std::vector<std::string> random_words(size_t count) {
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> length(4, 12);
+  std::uniform_int_distribution<int> letter('a', 'z');
+  std::vector<std::string> words(count);
+  for (std::string &word : words) {
+    word.resize(length(generator));
+    for (char &character : word) {
+      character = static_cast<char>(letter(generator));
+    }
+  }
+  return words;
+}
+
+/// Adapts "std::multiset" to the interface of "tree::Trie".
+class StringSet {
+public:
+  void insert(const std::string &word) { m_set.insert(word); }
+  bool erase(const std::string &word) {
+    auto it = m_set.find(word);
+    if (it == m_set.end()) {
+      return false;
+    }
+    m_set.erase(it);
+    return true;
+  }
+  size_t count(const std::string &word) const { return m_set.count(word); }
+  size_t size() const { return m_set.size(); }
+
+private:
+  std::multiset<std::string> m_set;
+};
+
+/// Creates a container with the words in "words".
+template <class Container>
+static void fill(Container &container, const std::vector<std::string> &words) {
+  for (const std::string &word : words) {
+    container.insert(word);
+  }
+}
+
+template <class Container> static void BM_Insert(benchmark::State &state) {
+  std::vector<std::string> words = random_words(state.range(0));
+  for (auto _ : state) {
+    Container container;
+    fill(container, words);
+    benchmark::DoNotOptimize(container.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Container> static void BM_Erase(benchmark::State &state) {
+  std::vector<std::string> words = random_words(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container container;
+    fill(container, words);
+    state.ResumeTiming();
+    for (const std::string &word : words) {
+      container.erase(word);
+    }
+    benchmark::DoNotOptimize(container.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Looks up 1024 words, half of them present in the container.
+template <class Container> static void BM_Lookup(benchmark::State &state) {
+  std::vector<std::string> words = random_words(state.range(0));
+  Container container;
+  fill(container, words);
+  std::vector<std::string> queries = random_words(1024);
+  for (size_t index{0}; index < queries.size(); index += 2) {
+    queries[index] = words[index % words.size()];
+  }
+  for (auto _ : state) {
+    size_t found{0};
+    for (const std::string &word : queries) {
+      found += container.count(word);
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * queries.size());
+}
+
+BENCHMARK_TEMPLATE(BM_Insert, tree::Trie)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Insert, StringSet)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Erase, tree::Trie)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Erase, StringSet)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Lookup, tree::Trie)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Lookup, StringSet)->Apply(sizes);
+
+BENCHMARK_MAIN();
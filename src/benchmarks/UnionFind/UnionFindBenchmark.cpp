@@ -0,0 +1,74 @@
+#include "UnionFind/UnionFind.h"
+#include "benchmark/benchmark.h"
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+/*
+ * There is no union find in "std", so only "tree::UnionFind" is measured. The
+ * argument of each benchmark is the number of elements in the container.
+ */
+
+/// Sizes to run every benchmark with: 1e2, 1e3, ..., 1e7 elements.
+static void sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(10)->Range(100, 10'000'000);
+}
+
+/// Generates "count" pseudo-random pairs of elements in the range [0, bound).
+static std::vector<std::pair<int64_t, int64_t>> random_pairs(size_t count,
+                                                             size_t bound) {
+  std::mt19937_64 generator(42);
+  std::uniform_int_distribution<int64_t> distribution(
+      0, static_cast<int64_t>(bound) - 1);
+  std::vector<std::pair<int64_t, int64_t>> pairs(count);
+  for (auto &pair : pairs) {
+    pair = {distribution(generator), distribution(generator)};
+  }
+  return pairs;
+}
+
+static void BM_Construct(benchmark::State &state) {
+  for (auto _ : state) {
+    tree::UnionFind container(state.range(0));
+    benchmark::DoNotOptimize(container.groups());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_Unite(benchmark::State &state) {
+  auto pairs = random_pairs(state.range(0), state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    tree::UnionFind container(state.range(0));
+    state.ResumeTiming();
+    for (auto [id1, id2] : pairs) {
+      container.unite(id1, id2);
+    }
+    benchmark::DoNotOptimize(container.groups());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Queries 1024 random pairs after half of the elements have been united.
+static void BM_Connected(benchmark::State &state) {
+  tree::UnionFind container(state.range(0));
+  for (auto [id1, id2] : random_pairs(state.range(0) / 2, state.range(0))) {
+    container.unite(id1, id2);
+  }
+  auto queries = random_pairs(1024, state.range(0));
+  for (auto _ : state) {
+    size_t connected{0};
+    for (auto [id1, id2] : queries) {
+      connected += container.connected(id1, id2);
+    }
+    benchmark::DoNotOptimize(connected);
+  }
+  state.SetItemsProcessed(state.iterations() * queries.size());
+}
+
+BENCHMARK(BM_Construct)->Apply(sizes);
+BENCHMARK(BM_Unite)->Apply(sizes);
+BENCHMARK(BM_Connected)->Apply(sizes);
+
+BENCHMARK_MAIN();
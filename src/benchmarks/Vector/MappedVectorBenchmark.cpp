@@ -0,0 +1,97 @@
+#include "Vector/MappedVector.h"
+#include "Vector/Vector.h"
+#include "benchmark/benchmark.h"
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+/*
+ * Compares rebuilding a table of uint64_t in a sc::vector with getting it back
+ * from a file with sc::mapped_vector, as a process does on start. The argument
+ * of each benchmark is the number of elements in the table.
+ */
+
+/// Sizes to run every benchmark with: 1e3, 1e4, ..., 1e7 elements.
+static void sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(10)->Range(1'000, 10'000'000);
+}
+
+/// Path of the file used by the benchmarks.
+static std::string table_path() {
+  return (std::filesystem::temp_directory_path() / "sc_mapped_vector_bench")
+      .string();
+}
+
+/// Writes a table with "size" elements to the file.
+static void write_table(size_t size) {
+  std::remove(table_path().c_str());
+  sc::mapped_vector<uint64_t> table(table_path());
+  table.reserve(size);
+  for (uint64_t index{0}; index < size; ++index) {
+    table.push_back(index);
+  }
+}
+
+static void BM_Rebuild(benchmark::State &state) {
+  const auto size = static_cast<uint64_t>(state.range(0));
+  for (auto _ : state) {
+    sc::vector<uint64_t> table;
+    for (uint64_t index{0}; index < size; ++index) {
+      table.push_back(index);
+    }
+    benchmark::DoNotOptimize(table.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PushBackMapped(benchmark::State &state) {
+  const auto size = static_cast<uint64_t>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::remove(table_path().c_str());
+    state.ResumeTiming();
+    sc::mapped_vector<uint64_t> table(table_path());
+    for (uint64_t index{0}; index < size; ++index) {
+      table.push_back(index);
+    }
+    benchmark::DoNotOptimize(table.data());
+  }
+  std::remove(table_path().c_str());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Maps the table back, touching only its last element.
+static void BM_Reopen(benchmark::State &state) {
+  write_table(state.range(0));
+  for (auto _ : state) {
+    const sc::mapped_vector<uint64_t> table(
+        table_path(), sc::mapped_vector<uint64_t>::mode::read_only);
+    benchmark::DoNotOptimize(table.back());
+  }
+  std::remove(table_path().c_str());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Maps the table back and reads every element of it.
+static void BM_ReopenAndScan(benchmark::State &state) {
+  write_table(state.range(0));
+  for (auto _ : state) {
+    const sc::mapped_vector<uint64_t> table(
+        table_path(), sc::mapped_vector<uint64_t>::mode::read_only);
+    uint64_t sum{0};
+    for (uint64_t value : table) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  std::remove(table_path().c_str());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Rebuild)->Apply(sizes);
+BENCHMARK(BM_PushBackMapped)->Apply(sizes);
+BENCHMARK(BM_Reopen)->Apply(sizes);
+BENCHMARK(BM_ReopenAndScan)->Apply(sizes);
+
+BENCHMARK_MAIN();
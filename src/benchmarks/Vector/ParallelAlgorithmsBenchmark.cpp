@@ -0,0 +1,109 @@
+#include "Vector/ParallelAlgorithms.h"
+#include "Vector/Vector.h"
+#include "benchmark/benchmark.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+
+/*
+ * Compares the parallel bulk operations with the serial ones over a sc::vector
+ * of int64_t. The first argument of each benchmark is the number of elements,
+ * the second one the number of threads of the pool. The times are wall clock
+ * ones, the CPU time of the calling thread hides the work of the others. Load
+ * a 100M elements vector with --benchmark_filter="/100000000/".
+ */
+
+/// Sizes to run every benchmark with, for 1, 2, 4 and 8 threads.
+static void parallel_sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->ArgsProduct(
+      {benchmark::CreateRange(1'000'000, 100'000'000, 10), {1, 2, 4, 8}});
+  benchmark->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+/// Sizes to run the serial version of every benchmark with.
+static void sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(10)->Range(1'000'000, 100'000'000);
+  benchmark->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+static sc::vector<int64_t> random_values(size_t size) {
+  std::mt19937_64 generator(size);
+  sc::vector<int64_t> result;
+  result.reserve(size);
+  for (size_t index{0}; index < size; ++index) {
+    result.push_back(static_cast<int64_t>(generator()));
+  }
+  return result;
+}
+
+static void BM_ConstructSerial(benchmark::State &state) {
+  auto source = random_values(state.range(0));
+  for (auto _ : state) {
+    sc::vector<int64_t> list(source.begin(), source.end());
+    benchmark::DoNotOptimize(list.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConstructSerial)->Apply(sizes);
+
+static void BM_ConstructParallel(benchmark::State &state) {
+  auto source = random_values(state.range(0));
+  sc::parallel::thread_pool pool(state.range(1));
+  for (auto _ : state) {
+    sc::vector<int64_t> list;
+    sc::parallel::assign(pool, list, source.begin(), source.end());
+    benchmark::DoNotOptimize(list.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConstructParallel)->Apply(parallel_sizes);
+
+static void BM_FillSerial(benchmark::State &state) {
+  sc::vector<int64_t> list(state.range(0), 0);
+  for (auto _ : state) {
+    std::fill(list.begin(), list.end(), 7);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FillSerial)->Apply(sizes);
+
+static void BM_FillParallel(benchmark::State &state) {
+  sc::vector<int64_t> list(state.range(0), 0);
+  sc::parallel::thread_pool pool(state.range(1));
+  for (auto _ : state) {
+    sc::parallel::fill(pool, list.begin(), list.end(), 7);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FillParallel)->Apply(parallel_sizes);
+
+static void BM_SortSerial(benchmark::State &state) {
+  auto source = random_values(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto list = source;
+    state.ResumeTiming();
+    std::sort(list.begin(), list.end());
+    benchmark::DoNotOptimize(list.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SortSerial)->Apply(sizes);
+
+static void BM_SortParallel(benchmark::State &state) {
+  auto source = random_values(state.range(0));
+  sc::parallel::thread_pool pool(state.range(1));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto list = source;
+    state.ResumeTiming();
+    sc::parallel::sort(pool, list.begin(), list.end());
+    benchmark::DoNotOptimize(list.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SortParallel)->Apply(parallel_sizes);
+
+BENCHMARK_MAIN();
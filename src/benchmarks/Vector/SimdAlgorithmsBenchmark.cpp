@@ -0,0 +1,140 @@
+#include "Vector/SimdAlgorithms.h"
+#include "Vector/Vector.h"
+#include "benchmark/benchmark.h"
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+/*
+ * Compares the vectorized algorithms with the std ones over a sc::vector of
+ * int32_t. The first argument of each benchmark is the number of elements, the
+ * second one the instruction set the sc::simd version is dispatched to, 0 for
+ * scalar, 1 for SSE2 and 2 for AVX2. Those the machine lacks are skipped.
+ */
+
+/// Sizes to run every benchmark with, from L1 resident to memory bound.
+static void sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(10)->Range(1'000, 10'000'000);
+}
+
+/// Sizes to run every benchmark with, for each instruction set.
+static void isa_sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->ArgsProduct(
+      {benchmark::CreateRange(1'000, 10'000'000, 10), {0, 1, 2}});
+}
+
+/// Selects the instruction set of the second argument, false if unsupported.
+static bool select_isa(benchmark::State &state) {
+  auto wanted = static_cast<sc::simd::isa>(state.range(1));
+  if (sc::simd::instruction_set(wanted) != wanted) {
+    state.SkipWithError("instruction set not supported");
+    return false;
+  }
+  return true;
+}
+
+/// Elements in [0, 1000), the value searched for is not among them.
+static sc::vector<int32_t> make_list(size_t size) {
+  sc::vector<int32_t> list;
+  list.reserve(size);
+  for (size_t index{0}; index < size; ++index) {
+    list.push_back(static_cast<int32_t>(index % 1000));
+  }
+  return list;
+}
+
+static void BM_FindStd(benchmark::State &state) {
+  auto list = make_list(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::find(list.begin(), list.end(), -1));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          sizeof(int32_t));
+}
+BENCHMARK(BM_FindStd)->Apply(sizes);
+
+static void BM_FindSimd(benchmark::State &state) {
+  if (!select_isa(state)) {
+    return;
+  }
+  auto list = make_list(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sc::simd::find(list, -1));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          sizeof(int32_t));
+}
+BENCHMARK(BM_FindSimd)->Apply(isa_sizes);
+
+static void BM_CountStd(benchmark::State &state) {
+  auto list = make_list(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::count(list.begin(), list.end(), 7));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          sizeof(int32_t));
+}
+BENCHMARK(BM_CountStd)->Apply(sizes);
+
+static void BM_CountSimd(benchmark::State &state) {
+  if (!select_isa(state)) {
+    return;
+  }
+  auto list = make_list(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sc::simd::count(list, 7));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          sizeof(int32_t));
+}
+BENCHMARK(BM_CountSimd)->Apply(isa_sizes);
+
+static void BM_MinMaxStd(benchmark::State &state) {
+  auto list = make_list(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::minmax_element(list.begin(), list.end()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          sizeof(int32_t));
+}
+BENCHMARK(BM_MinMaxStd)->Apply(sizes);
+
+static void BM_MinMaxSimd(benchmark::State &state) {
+  if (!select_isa(state)) {
+    return;
+  }
+  auto list = make_list(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sc::simd::min(list));
+    benchmark::DoNotOptimize(sc::simd::max(list));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          sizeof(int32_t));
+}
+BENCHMARK(BM_MinMaxSimd)->Apply(isa_sizes);
+
+static void BM_SumStd(benchmark::State &state) {
+  auto list = make_list(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        std::accumulate(list.begin(), list.end(), int64_t{0}));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          sizeof(int32_t));
+}
+BENCHMARK(BM_SumStd)->Apply(sizes);
+
+static void BM_SumSimd(benchmark::State &state) {
+  if (!select_isa(state)) {
+    return;
+  }
+  auto list = make_list(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sc::simd::sum(list));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          sizeof(int32_t));
+}
+BENCHMARK(BM_SumSimd)->Apply(isa_sizes);
+
+BENCHMARK_MAIN();
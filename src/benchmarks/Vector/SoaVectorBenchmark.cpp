@@ -0,0 +1,141 @@
+#include "Vector/SoaVector.h"
+#include "Vector/Vector.h"
+#include "benchmark/benchmark.h"
+#include <cstdint>
+#include <tuple>
+
+/*
+ * Compares a structure of arrays, sc::soa_vector, with an array of structures,
+ * sc::vector<Record>, holding the same records. Each record has 64 bytes, but
+ * the scans only read one or two of its fields. The argument of each benchmark
+ * is the number of records in the container.
+ */
+
+/// Record of the array of structures, a cache line wide.
+struct Record {
+  int64_t id;
+  double price;
+  double quantity;
+  char name[40];
+};
+/// Padding field of the structure of arrays, the same as Record::name.
+struct Name {
+  char value[40];
+};
+using Records = sc::soa_vector<int64_t, double, double, Name>;
+
+/// Sizes to run every benchmark with: 1e3, 1e4, ..., 1e7 records.
+static void sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(10)->Range(1'000, 10'000'000);
+}
+
+static sc::vector<Record> make_aos(size_t size) {
+  sc::vector<Record> records;
+  records.reserve(size);
+  for (size_t index{0}; index < size; ++index) {
+    records.push_back(Record{static_cast<int64_t>(index), 1.5, 2.0, {}});
+  }
+  return records;
+}
+
+static Records make_soa(size_t size) {
+  Records records;
+  records.reserve(size);
+  for (size_t index{0}; index < size; ++index) {
+    records.emplace_back(static_cast<int64_t>(index), 1.5, 2.0, Name{});
+  }
+  return records;
+}
+
+static void BM_PushBackAos(benchmark::State &state) {
+  for (auto _ : state) {
+    sc::vector<Record> records = make_aos(state.range(0));
+    benchmark::DoNotOptimize(records.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PushBackSoa(benchmark::State &state) {
+  for (auto _ : state) {
+    Records records = make_soa(state.range(0));
+    benchmark::DoNotOptimize(records.column<0>().data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Sums a single field, which strides over whole records.
+static void BM_ScanOneFieldAos(benchmark::State &state) {
+  const sc::vector<Record> records = make_aos(state.range(0));
+  for (auto _ : state) {
+    double sum{0};
+    for (const Record &record : records) {
+      sum += record.price;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Sums a single field, which is a contiguous column.
+static void BM_ScanOneFieldSoa(benchmark::State &state) {
+  const Records records = make_soa(state.range(0));
+  for (auto _ : state) {
+    double sum{0};
+    for (double price : records.column<1>()) {
+      sum += price;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Sums the product of two fields.
+static void BM_ScanTwoFieldsAos(benchmark::State &state) {
+  const sc::vector<Record> records = make_aos(state.range(0));
+  for (auto _ : state) {
+    double sum{0};
+    for (const Record &record : records) {
+      sum += record.price * record.quantity;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Sums the product of two fields, walking their columns with spans.
+static void BM_ScanTwoFieldsSoa(benchmark::State &state) {
+  const Records records = make_soa(state.range(0));
+  for (auto _ : state) {
+    auto prices = records.column<1>();
+    auto quantities = records.column<2>();
+    double sum{0};
+    for (size_t index{0}; index < prices.size(); ++index) {
+      sum += prices[index] * quantities[index];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Sums the product of two fields, walking the records with the iterator.
+static void BM_ScanTwoFieldsSoaZipped(benchmark::State &state) {
+  const Records records = make_soa(state.range(0));
+  for (auto _ : state) {
+    double sum{0};
+    for (auto it = records.begin(); it != records.end(); ++it) {
+      sum += it.get<1>() * it.get<2>();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_PushBackAos)->Apply(sizes);
+BENCHMARK(BM_PushBackSoa)->Apply(sizes);
+BENCHMARK(BM_ScanOneFieldAos)->Apply(sizes);
+BENCHMARK(BM_ScanOneFieldSoa)->Apply(sizes);
+BENCHMARK(BM_ScanTwoFieldsAos)->Apply(sizes);
+BENCHMARK(BM_ScanTwoFieldsSoa)->Apply(sizes);
+BENCHMARK(BM_ScanTwoFieldsSoaZipped)->Apply(sizes);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,82 @@
+#include "Vector/StableVector.h"
+#include "Vector/Vector.h"
+#include "benchmark/benchmark.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <numeric>
+
+/*
+ * Compares sc::stable_vector with sc::vector and std::deque when appending
+ * elements and when reading them back. Besides the average time, the push_back
+ * benchmarks report the slowest single push_back as the "worst_ns" counter,
+ * which for sc::vector is the reallocation of all its elements.
+ */
+
+/// Sizes to run every benchmark with.
+static void sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(10)->Range(1'000, 1'000'000);
+}
+
+template <typename Container>
+static void BM_PushBack(benchmark::State &state) {
+  using clock = std::chrono::steady_clock;
+  int64_t worst{0};
+  for (auto _ : state) {
+    Container list;
+    for (int64_t index{0}; index < state.range(0); ++index) {
+      auto start = clock::now();
+      list.push_back(index);
+      auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         clock::now() - start)
+                         .count();
+      worst = std::max<int64_t>(worst, elapsed);
+    }
+    benchmark::DoNotOptimize(&list.back());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["worst_ns"] = static_cast<double>(worst);
+}
+BENCHMARK_TEMPLATE(BM_PushBack, sc::vector<int64_t>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushBack, sc::stable_vector<int64_t>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushBack, std::deque<int64_t>)->Apply(sizes);
+
+template <typename Container>
+static void BM_Sum(benchmark::State &state) {
+  Container list;
+  for (int64_t index{0}; index < state.range(0); ++index) {
+    list.push_back(index);
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        std::accumulate(list.begin(), list.end(), int64_t{0}));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Sum, sc::vector<int64_t>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Sum, sc::stable_vector<int64_t>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Sum, std::deque<int64_t>)->Apply(sizes);
+
+template <typename Container>
+static void BM_RandomAccess(benchmark::State &state) {
+  Container list;
+  for (int64_t index{0}; index < state.range(0); ++index) {
+    list.push_back(index);
+  }
+  size_t size = list.size();
+  for (auto _ : state) {
+    int64_t total{0};
+    for (size_t index{0}, at{0}; index < size; ++index) {
+      total += list[at];
+      at = (at + 7919) % size;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_RandomAccess, sc::vector<int64_t>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_RandomAccess, sc::stable_vector<int64_t>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_RandomAccess, std::deque<int64_t>)->Apply(sizes);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,236 @@
+#include "Vector/SmallVector.h"
+#include "Vector/Vector.h"
+#include "benchmark/benchmark.h"
+#include <algorithm>
+#include <cstdint>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <vector>
+
+/*
+ * Every benchmark is a template instantiated once for "sc::vector" and once for
+ * "std::vector", so the numbers of both can be compared side by side. The
+ * argument of each benchmark is the number of elements in the container.
+ */
+
+/// Generates "count" pseudo-random indexes in the range [0, bound).
+static std::vector<size_t> random_indexes(size_t count, size_t bound) {
+  std::mt19937_64 generator(42);
+  std::uniform_int_distribution<size_t> distribution(0, bound - 1);
+  std::vector<size_t> indexes(count);
+  for (size_t &index : indexes) {
+    index = distribution(generator);
+  }
+  return indexes;
+}
+
+/// Sizes to run every benchmark with: 1e2, 1e3, ..., 1e7 elements.
+static void sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(10)->Range(100, 10'000'000);
+}
+
+/// Sizes for the quadratic benchmarks: 1e2, 1e3, 1e4 elements.
+static void middle_sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(10)->Range(100, 10'000);
+}
+
+/// Trivially copyable element with 64 bytes, the size of a cache line.
+struct Pod64 {
+  int64_t fields[8];
+};
+
+/// Sizes of the short-lived vectors: 2, 4, ..., 64 elements.
+static void small_sizes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->RangeMultiplier(2)->Range(2, 64);
+}
+
+template <class Container> static void BM_PushBack(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    Container container;
+    for (size_t index{0}; index < size; ++index) {
+      container.push_back(static_cast<int>(index));
+    }
+    benchmark::DoNotOptimize(container.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/*!
+ * Appends elements to a vector placed in a monotonic arena. The buffers left
+ * behind by the growth are not freed one by one, the arena releases them all
+ * at once in the end of each iteration.
+ */
+template <class Container>
+static void BM_PushBackArena(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  std::pmr::monotonic_buffer_resource arena;
+  for (auto _ : state) {
+    {
+      Container container(&arena);
+      for (size_t index{0}; index < size; ++index) {
+        container.push_back(static_cast<int>(index));
+      }
+      benchmark::DoNotOptimize(container.data());
+    }
+    arena.release();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/*!
+ * Builds many short-lived vectors, which is dominated by the allocations when
+ * they are in the heap.
+ */
+template <class Container>
+static void BM_PushBackSmall(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    for (int repetition{0}; repetition < 1024; ++repetition) {
+      Container container;
+      for (size_t index{0}; index < size; ++index) {
+        container.push_back(static_cast<int>(index));
+      }
+      benchmark::DoNotOptimize(container.data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 1024 * state.range(0));
+}
+
+/// Appends temporary strings, which are too long for small string optimization.
+template <class Container>
+static void BM_PushBackString(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    Container container;
+    for (size_t index{0}; index < size; ++index) {
+      container.push_back(std::string(32, 'a'));
+    }
+    benchmark::DoNotOptimize(container.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Appends batches of 16 elements with the range insert.
+template <class Container> static void BM_InsertBatch(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  const int batch[16] = {};
+  for (auto _ : state) {
+    Container container;
+    for (size_t index{0}; index < size; index += 16) {
+      container.insert(container.end(), batch, batch + 16);
+    }
+    benchmark::DoNotOptimize(container.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/*!
+ * Fills the container inserting every element in the middle, which shifts
+ * half of the elements each time.
+ */
+template <class Container>
+static void BM_InsertMiddle(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  const typename Container::value_type value{};
+  for (auto _ : state) {
+    Container container;
+    container.reserve(size);
+    for (size_t index{0}; index < size; ++index) {
+      container.insert(container.begin() + index / 2, value);
+    }
+    benchmark::DoNotOptimize(container.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Container> static void BM_EraseBack(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container container(size, 7);
+    state.ResumeTiming();
+    while (!container.empty()) {
+      container.erase(container.end() - 1);
+    }
+    benchmark::DoNotOptimize(container.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Container> static void BM_Lookup(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  Container container(size, 7);
+  std::vector<size_t> indexes = random_indexes(1024, size);
+  for (auto _ : state) {
+    int sum{0};
+    for (size_t index : indexes) {
+      sum += container[index];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * indexes.size());
+}
+
+template <class Container> static void BM_Iterate(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  Container container(size, 7);
+  for (auto _ : state) {
+    int sum{0};
+    for (int value : container) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Sorts the container with std::sort, which relies on the iterator traits.
+template <class Container> static void BM_Sort(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  std::vector<size_t> values = random_indexes(size, size);
+  Container container(size, 0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::copy(values.begin(), values.end(), container.begin());
+    state.ResumeTiming();
+    std::sort(container.begin(), container.end());
+    benchmark::DoNotOptimize(container.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_PushBack, sc::vector<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushBack, std::vector<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushBackArena, sc::pmr::vector<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushBackArena, std::pmr::vector<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushBackSmall, sc::vector<int>)->Apply(small_sizes);
+BENCHMARK_TEMPLATE(BM_PushBackSmall, sc::small_vector<int, 8>)
+    ->Apply(small_sizes);
+BENCHMARK_TEMPLATE(BM_PushBackSmall, std::vector<int>)->Apply(small_sizes);
+BENCHMARK_TEMPLATE(BM_PushBackString, sc::vector<std::string>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushBackString, std::vector<std::string>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_InsertBatch, sc::vector<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_InsertBatch,
+                   sc::vector<int, sc::growth::OneAndHalf<int>>)
+    ->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_InsertBatch,
+                   sc::vector<int, sc::growth::PageAligned<int>>)
+    ->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_InsertBatch, std::vector<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_InsertMiddle, sc::vector<int>)->Apply(middle_sizes);
+BENCHMARK_TEMPLATE(BM_InsertMiddle, std::vector<int>)->Apply(middle_sizes);
+BENCHMARK_TEMPLATE(BM_InsertMiddle, sc::vector<Pod64>)->Apply(middle_sizes);
+BENCHMARK_TEMPLATE(BM_InsertMiddle, std::vector<Pod64>)->Apply(middle_sizes);
+BENCHMARK_TEMPLATE(BM_EraseBack, sc::vector<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_EraseBack, std::vector<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Lookup, sc::vector<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Lookup, std::vector<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, sc::vector<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, std::vector<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(BM_Sort, sc::vector<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Sort, std::vector<int>)->Apply(sizes);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,44 @@
+#ifndef SRC_INCLUDE_ADAPTER_ADAPTERTRAITS_H_
+#define SRC_INCLUDE_ADAPTER_ADAPTERTRAITS_H_
+
+#include <iterator>    // iterator_traits, forward_iterator_tag
+#include <type_traits> // false_type, is_base_of, true_type, void_t
+#include <utility>     // declval
+
+// Namespace for sequential containers(sc).
+namespace sc {
+/*
+ * Traits of the underlying container of the adapters sc::queue and sc::stack,
+ * which pick between batch operations of the container and element by element
+ * loops with them.
+ */
+namespace detail {
+/// Whether "Container" can insert a forward range of InputIt at once.
+template <typename Container, typename InputIt, typename = void>
+struct range_insertable : std::false_type {};
+template <typename Container, typename InputIt>
+struct range_insertable<
+    Container, InputIt,
+    std::void_t<decltype(std::declval<Container &>().insert(
+        std::declval<Container &>().end(), std::declval<InputIt>(),
+        std::declval<InputIt>()))>>
+    : std::is_base_of<
+          std::forward_iterator_tag,
+          typename std::iterator_traits<InputIt>::iterator_category> {};
+/*!
+ * Whether "Container" can erase a range of its elements at once. "Dummy" is a
+ * template parameter of the caller, so that the branch not taken is not
+ * instantiated.
+ */
+template <typename Container, typename Dummy, typename = void>
+struct range_erasable : std::false_type {};
+template <typename Container, typename Dummy>
+struct range_erasable<Container, Dummy,
+                      std::void_t<decltype(std::declval<Container &>().erase(
+                          std::declval<Container &>().begin(),
+                          std::declval<Container &>().begin()))>>
+    : std::true_type {};
+} // namespace detail
+} // namespace sc
+
+#endif // SRC_INCLUDE_ADAPTER_ADAPTERTRAITS_H_
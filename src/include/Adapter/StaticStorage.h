@@ -0,0 +1,122 @@
+#ifndef SRC_INCLUDE_ADAPTER_STATICSTORAGE_H_
+#define SRC_INCLUDE_ADAPTER_STATICSTORAGE_H_
+
+#include <cstddef>     // size_t
+#include <new>         // launder, placement new
+#include <type_traits> // is_trivially_copyable_v
+#include <utility>     // forward, move
+
+// Namespace for sequential containers(sc).
+namespace sc {
+namespace detail {
+/*!
+ * Ring of N slots stored inside the object, the storage of sc::static_queue and
+ * sc::static_stack. The elements are the "size" slots starting at "head",
+ * wrapping around the end; the stack keeps "head" at 0.
+ *
+ * Trivially copyable and trivially default constructible types are kept in a
+ * plain array, which is a literal type, so the storage can be used in
+ * compile-time evaluation. C++17 requires a constexpr constructor to
+ * initialize the array, so creating it value-initializes the N slots, which
+ * costs O(N) at run time. Other types are kept in raw storage and only
+ * constructed when inserted.
+ * \tparam T type of the elements.
+ * \tparam N number of slots.
+ * \tparam Trivial whether the elements are kept in a plain array.
+ */
+template <class T, size_t N,
+          bool Trivial = std::is_trivially_copyable_v<T> &&
+                         std::is_trivially_default_constructible_v<T>>
+struct static_storage;
+
+/// Plain array, which is a literal type, for trivial elements.
+template <class T, size_t N> struct static_storage<T, N, true> {
+  T data[N]{};    //!< Slots of the ring.
+  size_t head{0}; //!< Slot of the first element.
+  size_t size{0}; //!< Number of elements in the ring.
+
+  /// Turns an index in [0, 2N) into the index of its slot in the ring.
+  static constexpr size_t wrap(size_t index) {
+    return index < N ? index : index - N;
+  }
+  constexpr T &element(size_t index) { return data[index]; }
+  constexpr const T &element(size_t index) const { return data[index]; }
+  template <class... Args>
+  constexpr void construct(size_t index, Args &&...args) {
+    data[index] = T(std::forward<Args>(args)...);
+  }
+  constexpr void destroy(size_t /* index */) {}
+};
+
+/// Raw storage whose elements only live while they are in the ring.
+template <class T, size_t N> struct static_storage<T, N, false> {
+  alignas(T) unsigned char data[N * sizeof(T)]; //!< Slots of the ring.
+  size_t head{0}; //!< Slot of the first element.
+  size_t size{0}; //!< Number of elements in the ring.
+
+  static_storage() = default;
+  static_storage(const static_storage &other) { copy_from(other); }
+  static_storage(static_storage &&other) { move_from(other); }
+  static_storage &operator=(const static_storage &other) {
+    if (this != &other) {
+      clear();
+      copy_from(other);
+    }
+    return *this;
+  }
+  static_storage &operator=(static_storage &&other) {
+    if (this != &other) {
+      clear();
+      move_from(other);
+    }
+    return *this;
+  }
+  ~static_storage() { clear(); }
+
+  /// Turns an index in [0, 2N) into the index of its slot in the ring.
+  static constexpr size_t wrap(size_t index) {
+    return index < N ? index : index - N;
+  }
+  T &element(size_t index) {
+    return std::launder(reinterpret_cast<T *>(data))[index];
+  }
+  const T &element(size_t index) const {
+    return std::launder(reinterpret_cast<const T *>(data))[index];
+  }
+  template <class... Args> void construct(size_t index, Args &&...args) {
+    ::new (data + index * sizeof(T)) T(std::forward<Args>(args)...);
+  }
+  void destroy(size_t index) { element(index).~T(); }
+  void clear() {
+    for (; size > 0; --size, head = wrap(head + 1)) {
+      destroy(head);
+    }
+    head = 0;
+  }
+  /// Copies the elements of "other" into this, which must be empty.
+  void copy_from(const static_storage &other) {
+    try {
+      for (; size < other.size; ++size) {
+        construct(size, other.element(wrap(other.head + size)));
+      }
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+  /// Moves the elements of "other" into this, which must be empty.
+  void move_from(static_storage &other) {
+    try {
+      for (; size < other.size; ++size) {
+        construct(size, std::move(other.element(wrap(other.head + size))));
+      }
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+};
+} // namespace detail
+} // namespace sc
+
+#endif // SRC_INCLUDE_ADAPTER_STATICSTORAGE_H_
@@ -1,37 +1,54 @@
 #ifndef SRC_INCLUDE_DEQUE_DEQUE_H_
 #define SRC_INCLUDE_DEQUE_DEQUE_H_
 
-#include <algorithm> // move
-#include <array>
-#include <cmath>   // floor, ceil
-#include <cstddef> // size_t, ptrdiff_t
-#include <cstdlib> // abs
+#include <algorithm> // copy, copy_backward, fill, max, move, rotate
+#include <cstddef>   // size_t, ptrdiff_t
 #include <initializer_list>
-#include <iterator> // distance
-#include <memory>   // unique_ptr, make_unique
-#include <utility>  // move
+#include <iterator>    // distance, random_access_iterator_tag, reverse_iterator
+#include <memory>      // allocator
+#include <new>         // placement new
+#include <type_traits> // enable_if_t, is_same_v, remove_const_t
+#include <utility>     // move, swap
 #include <vector>
 
 // Namespace for sequential containers(sc).
 namespace sc {
+/*!
+ * Default number of elements per block of a deque: as many as fit in 4 KiB,
+ * but never less than 16, so that big types still get several per block.
+ */
+template <typename T> constexpr size_t deque_block_size() {
+  return 4096 / sizeof(T) < 16 ? 16 : 4096 / sizeof(T);
+}
+
 /*!
  * Double ended queue. Allows quick storage and deletion of values in both ends
  * of the container, as well as allows quick retrieval of elements. Important:
  * it is not implemented as a double linked list, so its not efficient to store
  * and delete in the middle of the container, however it is faster to traverse
  * and search for values at specific positions the container.
+ *
+ * The elements live in blocks of raw memory that hold BlockSize elements, and
+ * a map of blocks (mob) keeps the addresses of the blocks in order. Only the
+ * slots between the head and the tail hold constructed elements. The blocks
+ * left behind by the ends go to a cache and are reused before allocating new
+ * ones, so a deque used as a queue stops allocating once it is warmed up.
  * \tparam T data type to store.
- * \tparam BlockSize size of each block in the deque.
+ * \tparam BlockSize size of each block in the deque. Default = the number of
+ *         elements that fit in 4 KiB, at least 16.
  * \tparam DefaultMobCapacity initial capacity of the map of blocks.
  *
  * \author Eduardo Marinho (eduardo.nestor.marinho228@gmail.com)
  */
-template <typename T, size_t BlockSize = 3, size_t DefaultMobCapacity = 5>
+template <typename T, size_t BlockSize = deque_block_size<T>(),
+          size_t DefaultMobCapacity = 5>
 class deque {
+  static_assert(BlockSize > 0, "a deque block must hold at least one element");
+  static_assert(DefaultMobCapacity > 0, "the mob must hold at least one block");
+
 public:
   // Forward declaration.
-  template <typename ItType, typename BlockItr, typename ItemItr>
-  class DequeIterator;
+  template <typename Value> class DequeIterator;
   //=== Aliases.
   using value_type = T;
   using pointer = value_type *;
@@ -40,13 +57,11 @@ public:
   using const_reference = const value_type &;
   using size_type = size_t;
   using difference_type = std::ptrdiff_t;
-  using block_t = std::array<T, BlockSize>;
-  using block_list_t = std::vector<std::unique_ptr<block_t>>;
-  using iterator = DequeIterator<T, typename block_list_t::iterator,
-                                 typename block_t::iterator>;
-  using const_iterator =
-      DequeIterator<const T, typename block_list_t::const_iterator,
-                    typename block_t::const_iterator>;
+  using block_list_t = std::vector<pointer>;
+  using iterator = DequeIterator<value_type>;
+  using const_iterator = DequeIterator<const value_type>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
   //=== [I] Special Functions.
   /// Creates an empty container.
@@ -57,19 +72,7 @@ public:
    */
   deque(std::initializer_list<value_type> ilist) {
     initialize_control_variables();
-    reallocate_mob((2 * ilist.size()));
-    if (ilist.size() == 0) {
-      return;
-    }
-    for (auto runner = ilist.begin() + ilist.size() / 2;
-         runner != ilist.begin(); --runner) {
-      push_front(*runner);
-    }
-    push_front(*ilist.begin());
-    for (auto runner = ilist.begin() + ilist.size() / 2 + 1;
-         runner != ilist.end(); ++runner) {
-      push_back(*runner);
-    }
+    insert(end(), ilist);
   }
   /*!
    * Construct a deque containing the elements presents in the range
@@ -79,45 +82,47 @@ public:
    */
   template <typename InputIt> deque(InputIt first, InputIt last) {
     initialize_control_variables();
-    difference_type range_size = last - first;
-    if (range_size == 0) {
-      return;
-    }
-    reallocate_mob(2 * range_size);
-    for (difference_type index = range_size / 2; index >= 0; --index) {
-      push_front(*(first + index));
-    }
-    for (difference_type index = range_size / 2 + 1; index < range_size;
-         ++index) {
-      push_back(*(first + index));
-    }
+    insert(end(), first, last);
   }
   /// Construct a clone of the deque "other".
   deque(const deque &other) {
     initialize_control_variables();
-    reallocate_mob(other.m_mob_capacity);
-    if (other.empty()) {
-      return;
+    insert(end(), other.cbegin(), other.cend());
+  }
+  /*!
+   * Construct a deque that takes ownership of memory from "other". "other" is
+   * left empty and without a map of blocks, which it allocates again on the
+   * next insertion, so moving never allocates.
+   */
+  deque(deque &&other) noexcept { swap(other); }
+  /// Makes this deque a clone of "other".
+  deque &operator=(const deque &other) {
+    if (this != &other) {
+      deque copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+  /// Makes this deque take ownership of the memory of "other".
+  deque &operator=(deque &&other) noexcept {
+    if (this != &other) {
+      deque moved(std::move(other));
+      swap(moved);
     }
-    for (iterator it = other.m_head + other.m_size / 2; it != other.m_head;
-         --it) {
-      push_front(*it);
+    return *this;
+  }
+  /// Destroys the elements and deallocates the blocks.
+  ~deque() {
+    destroy(m_head, m_tail);
+    for (pointer block : m_mob) {
+      if (block != nullptr) {
+        m_allocator.deallocate(block, BlockSize);
+      }
     }
-    push_front(*other.m_head);
-    for (iterator it = other.m_head + other.m_size / 2 + 1; it != other.m_tail;
-         ++it) {
-      push_back(*it);
+    for (pointer block : m_free_blocks) {
+      m_allocator.deallocate(block, BlockSize);
     }
   }
-  /// Construct a deque that takes ownership of memory from "other".
-  deque(deque &&other) {
-    initialize_control_variables();
-    std::swap(m_mob_capacity, other.m_mob_capacity);
-    std::swap(m_size, other.m_size);
-    m_mob = std::move(other.m_mob);
-    m_head = std::move(other.m_head);
-    m_tail = std::move(other.m_tail);
-  }
 
   //=== [II] Element Access.
   /// Consults the element in the "pos" index at the container.
@@ -143,44 +148,69 @@ public:
   /// Gets an iterator to the end of the container.
   iterator end() { return m_tail; }
   /// Gets a constant iterator to the begin of the container.
+  const_iterator begin() const { return cbegin(); }
+  /// Gets a constant iterator to the end of the container.
+  const_iterator end() const { return cend(); }
+  /// Gets a constant iterator to the begin of the container.
   const_iterator cbegin() const { return const_iterator(m_head); }
   /// Gets a constant iterator to the end of the container.
   const_iterator cend() const { return const_iterator(m_tail); }
+  /// Gets a reverse iterator to the last element of the container.
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  /// Gets a reverse iterator to the element before the first one.
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  /// Gets a constant reverse iterator to the last element of the container.
+  const_reverse_iterator rbegin() const { return crbegin(); }
+  /// Gets a constant reverse iterator to the element before the first one.
+  const_reverse_iterator rend() const { return crend(); }
+  /// Gets a constant reverse iterator to the last element of the container.
+  const_reverse_iterator crbegin() const {
+    return const_reverse_iterator(cend());
+  }
+  /// Gets a constant reverse iterator to the element before the first one.
+  const_reverse_iterator crend() const {
+    return const_reverse_iterator(cbegin());
+  }
 
   //=== [IV] Capacity.
   /// Consults whether the container is empty.
   [[nodiscard]] bool empty() const { return m_size == 0; }
   /// Consults the number of elements in the container.
   [[nodiscard]] size_type size() const { return m_size; }
-  /// Frees the memory not being used.
+  /// Frees the blocks not being used, including the cached ones.
   void shrink_to_fit() {
-    if (m_head.get_block_it() != m_mob.begin()) {
-      for (typename block_list_t::iterator runner = m_head.get_block_it() - 1;
-           runner != m_mob.begin(); --runner) {
-        if (*runner != nullptr) {
-          runner->reset();
-        }
-      }
-      if (*m_mob.begin() != nullptr) {
-        m_mob.begin()->reset();
-      }
+    if (m_mob.empty()) {
+      return;
     }
-    for (typename block_list_t::iterator runner = m_tail.get_block_it() + 1;
-         runner != m_mob.end(); ++runner) {
-      if (*runner != nullptr) {
-        runner->reset();
+    size_type head_block = m_head.get_block_it() - m_mob.data();
+    size_type tail_block = m_tail.get_block_it() - m_mob.data();
+    for (size_type index{0}; index < m_mob.size(); ++index) {
+      if ((index < head_block || index > tail_block) &&
+          m_mob[index] != nullptr) {
+        release_block(index);
       }
     }
+    for (pointer block : m_free_blocks) {
+      m_allocator.deallocate(block, BlockSize);
+    }
+    m_blocks -= m_free_blocks.size();
+    m_free_blocks.clear();
   }
 
   //=== [V] Modifiers.
   /// Clears the contents of the container, i.e. makes it empty.
   void clear() {
-    typename block_list_t::iterator mob_mid_it =
-        m_mob.begin() + m_mob_capacity / 2;
-    typename block_t::iterator block_mid_it =
-        (*mob_mid_it)->begin() + BlockSize / 2;
-    m_head = iterator(mob_mid_it, block_mid_it);
+    if (m_mob.empty()) {
+      return;
+    }
+    destroy(m_head, m_tail);
+    size_type head_block = m_head.get_block_it() - m_mob.data();
+    size_type tail_block = m_tail.get_block_it() - m_mob.data();
+    for (size_type index{head_block + 1}; index <= tail_block; ++index) {
+      release_block(index);
+    }
+    auto block = m_head.get_block_it();
+    m_head = iterator(block, *block + BlockSize / 2);
     m_tail = m_head;
     m_size = 0;
   }
@@ -191,21 +221,9 @@ public:
    * \return iterator pointing to the inserted value.
    */
   iterator insert(iterator pos, const_reference value) {
-    position_e position = closer_to(pos);
-    pos = space_vacancy(position, pos, 1);
-    if (pos == m_head) {
-      --m_head;
-      --pos;
-    } else if (position == position_e::FRONT) {
-      copy(m_head, pos, m_head - 1);
-      --m_head;
-    } else {
-      copy_backward(pos, m_tail, m_tail + 1);
-      ++m_tail;
-    }
-    ++m_size;
-    *pos = value;
-    return pos;
+    return insert_constructed(pos, 1, [&value](pointer slot) {
+      ::new (slot) value_type(value);
+    });
   }
   /*!
    * Inserts "count" copies of the element "value" before the iterator "pos".
@@ -217,26 +235,9 @@ public:
    *         inserted.
    */
   iterator insert(size_type count, const_reference value, iterator pos) {
-    m_size += count;
-    position_e position = closer_to(pos);
-    pos = space_vacancy(position, pos, count);
-    if (pos == m_tail) {
-      m_tail = m_tail + count;
-      pos = m_tail - 1;
-    } else if (position == position_e::FRONT) {
-      copy(m_head, pos, m_head - count);
-      --pos;
-      m_head = m_head - count;
-    } else {
-      copy_backward(pos + 1, m_tail, m_tail + count);
-      m_tail = m_tail + count;
-      pos = pos + count - 1;
-    }
-    for (size_type counter{0}; counter < count; ++counter) {
-      *pos = value;
-      --pos;
-    }
-    return pos + 1;
+    return insert_constructed(pos, count, [&value](pointer slot) {
+      ::new (slot) value_type(value);
+    });
   }
   /*!
    * Inserts the elements in the range [first, last) before the iterator "pos".
@@ -249,29 +250,11 @@ public:
    */
   template <class InputIt>
   iterator insert(iterator pos, InputIt first, InputIt last) {
-    size_type range_size = last - first;
-    m_size += range_size;
-    position_e position = closer_to(pos);
-    pos = space_vacancy(position, pos, range_size);
-    if (position == position_e::FRONT) {
-      copy(m_head, pos, m_head - range_size);
-      for (InputIt pointer = last - 1; pointer != first; --pointer) {
-        --pos;
-        *pos = *pointer;
-      }
-      --pos;
-      *pos = *first;
-      m_head = m_head - range_size;
-      return pos;
-    } else if (pos != m_tail) {
-      copy_backward(pos + 1, m_tail, m_tail + range_size);
-    }
-    for (; first != last; ++first) {
-      *pos = *first;
-      ++pos;
-    }
-    m_tail = m_tail + range_size;
-    return pos - range_size;
+    size_type range_size = std::distance(first, last);
+    return insert_constructed(pos, range_size, [&first](pointer slot) {
+      ::new (slot) value_type(*first);
+      ++first;
+    });
   }
   /*!
    * Inserts the elements in "ilist" before the iterator "pos".
@@ -282,51 +265,14 @@ public:
    *         inserted.
    */
   iterator insert(iterator pos, std::initializer_list<value_type> ilist) {
-    if (ilist.size() == 0) {
-      return pos;
-    }
-    m_size += ilist.size();
-    position_e position = closer_to(pos);
-    pos = space_vacancy(position, pos, ilist.size());
-    if (position == position_e::FRONT) {
-      copy(m_head, pos, m_head - ilist.size());
-      for (auto list_it = ilist.end() - 1; list_it != ilist.begin();
-           --list_it) {
-        --pos;
-        *pos = *list_it;
-      }
-      --pos;
-      *pos = *ilist.begin();
-      m_head = m_head - ilist.size();
-      return pos;
-    } else if (pos != m_tail) {
-      copy_backward(pos, m_tail, m_tail + ilist.size());
-    }
-    for (value_type value : ilist) {
-      *pos = value;
-      ++pos;
-    }
-    m_tail = m_tail + ilist.size();
-    return pos - ilist.size();
+    return insert(pos, ilist.begin(), ilist.end());
   }
   /*!
    * Erase the element being pointed by "pos".
    * \param pos iterator pointing to the element to be removed.
    * \return iterator pointing to the element following the removed one.
    */
-  iterator erase(iterator pos) {
-    --m_size;
-    position_e position = closer_to(pos);
-    if (position == position_e::FRONT) {
-      copy_backward(m_head, pos, pos + 1);
-      ++m_head;
-      return pos + 1;
-    } else {
-      copy(pos + 1, m_tail, pos);
-      --m_tail;
-      return pos;
-    }
-  }
+  iterator erase(iterator pos) { return erase(pos, pos + 1); }
   /*!
    * Erases all elements in the range [first, last).
    * \param first iterator to the start of the range.
@@ -338,26 +284,92 @@ public:
     if (first == last) {
       return last;
     }
+    difference_type index = first - m_head;
     difference_type range_size = last - first;
-    m_size -= range_size;
-    if (closer_to(first) == position_e::FRONT) {
-      copy_backward(m_head, first, last);
-      m_head = m_head + range_size;
-      return last;
+    difference_type after = static_cast<difference_type>(m_size) - index -
+                            range_size;
+    if (index < after) {
+      std::move_backward(m_head, first, last);
+      iterator new_head = m_head + range_size;
+      destroy(m_head, new_head);
+      m_head = new_head;
     } else {
-      copy(last, m_tail, first);
-      m_tail = m_tail - range_size;
-      return first;
+      std::move(last, m_tail, first);
+      iterator new_tail = m_tail - range_size;
+      destroy(new_tail, m_tail);
+      m_tail = new_tail;
+    }
+    m_size -= range_size;
+    return m_head + index;
+  }
+  /*!
+   * Constructs an element in place in the back of the deque. Only when the
+   * tail reaches the end of its block a new block is needed, otherwise this
+   * just advances the tail.
+   * \param args arguments to forward to the constructor of the element.
+   * \return reference to the inserted element.
+   */
+  template <typename... Args> reference emplace_back(Args &&...args) {
+    if (m_mob.empty()) {
+      initialize_control_variables();
     }
+    if (m_tail.get_element_it() + 1 == *m_tail.get_block_it() + BlockSize) {
+      space_vacancy(position_e::BACK, 1);
+    }
+    pointer slot = m_tail.get_element_it();
+    ::new (slot) value_type(std::forward<Args>(args)...);
+    ++m_tail;
+    ++m_size;
+    return *slot;
+  }
+  /*!
+   * Constructs an element in place in the front of the deque. Only when the
+   * head is at the beginning of its block a new block is needed, otherwise
+   * this just moves the head back.
+   * \param args arguments to forward to the constructor of the element.
+   * \return reference to the inserted element.
+   */
+  template <typename... Args> reference emplace_front(Args &&...args) {
+    if (m_mob.empty()) {
+      initialize_control_variables();
+    }
+    if (m_head.get_element_it() == *m_head.get_block_it()) {
+      space_vacancy(position_e::FRONT, 1);
+    }
+    iterator new_head = m_head;
+    --new_head;
+    ::new (new_head.get_element_it()) value_type(std::forward<Args>(args)...);
+    m_head = new_head;
+    ++m_size;
+    return *m_head;
   }
   /// Inserts "value" in the back of the deque.
-  void push_back(const_reference value) { insert(end(), value); }
+  void push_back(const_reference value) { emplace_back(value); }
+  /// Inserts "value" in the back of the deque, moving it.
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
   /// Inserts "value" in the front of the deque.
-  void push_front(const_reference value) { insert(begin(), value); }
+  void push_front(const_reference value) { emplace_front(value); }
+  /// Inserts "value" in the front of the deque, moving it.
+  void push_front(value_type &&value) { emplace_front(std::move(value)); }
   /// Removes the last element of the deque.
-  void pop_back() { erase(--end()); }
+  void pop_back() {
+    bool leaves_block = m_tail.get_element_it() == *m_tail.get_block_it();
+    --m_tail;
+    m_tail->~value_type();
+    --m_size;
+    if (leaves_block) {
+      release_block(m_tail.get_block_it() - m_mob.data() + 1);
+    }
+  }
   /// Removes the first element of the deque.
-  void pop_front() { erase(begin()); }
+  void pop_front() {
+    m_head->~value_type();
+    ++m_head;
+    --m_size;
+    if (m_head.get_element_it() == *m_head.get_block_it()) {
+      release_block(m_head.get_block_it() - m_mob.data() - 1);
+    }
+  }
   /*!
    * Resizes the deque to contain "count" elements. If "counts" == m_size does
    * nothing, else if "count" < m_size the container is reduced to the first
@@ -369,55 +381,62 @@ public:
    */
   void resize(size_type count, const_reference value = value_type()) {
     if (m_size > count) {
-      m_tail = m_tail - (m_size - count);
-      m_size = count;
-    }
-    for (size_type counter{m_size}; counter < count; ++counter) {
-      push_back(value);
+      erase(m_head + count, m_tail);
+    } else {
+      insert(count - m_size, value, m_tail);
     }
   }
+  /// Exchanges the contents of this deque with the ones of "other".
+  void swap(deque &other) noexcept {
+    m_mob.swap(other.m_mob);
+    m_free_blocks.swap(other.m_free_blocks);
+    std::swap(m_blocks, other.m_blocks);
+    std::swap(m_size, other.m_size);
+    std::swap(m_head, other.m_head);
+    std::swap(m_tail, other.m_tail);
+  }
 
-  template <typename ItType, typename BlockItr, typename ElementItr>
-  class DequeIterator {
+  template <typename Value> class DequeIterator {
   public:
     ///=== Aliases.
-    using value_type = ItType;
-    using pointer = value_type *;
-    using const_pointer = const value_type *;
-    using reference = value_type &;
-    using const_reference = const value_type &;
-    using size_type = size_t;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_const_t<Value>;
+    using pointer = Value *;
+    using reference = Value &;
     using difference_type = std::ptrdiff_t;
+    using block_pointer = value_type *const *;
+
+    /// Number of elements per block, to walk the deque block by block.
+    static constexpr size_type block_size = BlockSize;
 
     /// Default constructor.
     DequeIterator() = default;
     /// Constructs an iterator.
-    DequeIterator(BlockItr block, ElementItr element)
+    DequeIterator(block_pointer block, pointer element)
         : m_block(block), m_element(element) {}
-    /// Copy constructor.
-    DequeIterator(const DequeIterator &copy)
-        : m_block(copy.m_block), m_element(copy.m_element) {}
-    /// Makes this iterator points to the same element as "other".
-    DequeIterator operator=(const DequeIterator &other) {
-      m_block = other.m_block;
-      m_element = other.m_element;
-      return *this;
-    }
-    explicit DequeIterator(iterator other)
+    /// Converts a mutable iterator into a constant one.
+    template <typename Other,
+              typename = std::enable_if_t<std::is_same_v<const Other, Value> &&
+                                          !std::is_same_v<Other, Value>>>
+    DequeIterator(const DequeIterator<Other> &other)
         : m_block(other.get_block_it()), m_element(other.get_element_it()) {}
     /// Dereference operator
-    reference operator*() { return *m_element; }
-    /// Constant dereference operator
-    const_reference operator*() const { return *m_element; }
-    /// Gets the iterator to the block this iterator points to.
-    BlockItr get_block_it() const { return m_block; }
-    /// Gets the iterator to the element this iterator points to.
-    ElementItr get_element_it() const { return m_element; }
+    reference operator*() const { return *m_element; }
+    /// Arrow operator
+    pointer operator->() const { return m_element; }
+    /// Consults the element "offset" positions away.
+    reference operator[](difference_type offset) const {
+      return *(*this + offset);
+    }
+    /// Gets the pointer to the block this iterator points to.
+    block_pointer get_block_it() const { return m_block; }
+    /// Gets the pointer to the element this iterator points to.
+    pointer get_element_it() const { return m_element; }
     /// Increment operator.
     DequeIterator &operator++() {
-      if (++m_element == (*m_block)->end()) {
+      if (++m_element == *m_block + BlockSize) {
         ++m_block;
-        m_element = (*m_block)->begin();
+        m_element = *m_block;
       }
       return *this;
     }
@@ -429,52 +448,56 @@ public:
     }
     /// Decrement operator.
     DequeIterator &operator--() {
-      if (m_element == (*m_block)->begin()) {
+      if (m_element == *m_block) {
         --m_block;
-        m_element = (*m_block)->end() - 1;
-      } else {
-        --m_element;
+        m_element = *m_block + BlockSize;
       }
+      --m_element;
       return *this;
     }
     /// Post decrement operator.
-    DequeIterator &operator--(int) {
+    DequeIterator operator--(int) {
       DequeIterator cp = *this;
       --(*this);
       return cp;
     }
+    /*!
+     * Advances the iterator "increment" positions, that can be negative. When
+     * the target is in the same block only the element pointer moves, the
+     * index of the block is computed only when the jump leaves it.
+     */
+    DequeIterator &operator+=(difference_type increment) {
+      constexpr auto size = static_cast<difference_type>(BlockSize);
+      difference_type offset = (m_element - *m_block) + increment;
+      if (offset >= 0 && offset < size) {
+        m_element += increment;
+        return *this;
+      }
+      // Rounds towards minus infinity, to go back to previous blocks.
+      difference_type blocks =
+          offset >= 0 ? offset / size : -((-offset - 1) / size) - 1;
+      m_block += blocks;
+      m_element = *m_block + (offset - blocks * size);
+      return *this;
+    }
+    /// Moves the iterator back "decrement" positions.
+    DequeIterator &operator-=(difference_type decrement) {
+      return *this += -decrement;
+    }
     /// Sum operator
-    friend DequeIterator operator+(const DequeIterator &it,
+    friend DequeIterator operator+(DequeIterator it,
                                    difference_type increment) {
-      DequeIterator result = it;
-      if (increment > 0) {
-        difference_type element_index = it.m_element - (*it.m_block)->begin();
-        difference_type blocks_to_advance =
-            std::floor(element_index + increment) /
-            static_cast<float>(BlockSize);
-        element_index = (element_index + (increment % BlockSize)) % BlockSize;
-        result.m_block = it.m_block + blocks_to_advance;
-        result.m_element = (*result.m_block)->begin() + element_index;
-      }
-      for (difference_type counter{0}; counter > increment; --counter) {
-        --result;
-      }
-      return result;
+      return it += increment;
     }
     /// Sum operator
     friend DequeIterator operator+(difference_type increment,
-                                   const DequeIterator &it) {
-      return it + increment;
+                                   DequeIterator it) {
+      return it += increment;
     }
     /// Subtract operator
-    friend DequeIterator operator-(const DequeIterator &it,
+    friend DequeIterator operator-(DequeIterator it,
                                    difference_type decrement) {
-      return it + (-decrement);
-    }
-    /// Subtract operator
-    friend DequeIterator operator-(difference_type decrement,
-                                   const DequeIterator &it) {
-      return it + (-decrement);
+      return it -= decrement;
     }
     /// Difference operator. Returns the distance between "rhs" to "lhs".
     friend difference_type operator-(const DequeIterator &lhs,
@@ -482,22 +505,41 @@ public:
       if (lhs.m_block == rhs.m_block) {
         return lhs.m_element - rhs.m_element;
       }
-      difference_type lhs_index = lhs.m_element - (*lhs.m_block)->begin();
-      difference_type rhs_index = rhs.m_element - (*rhs.m_block)->begin();
-      return (lhs.m_block - rhs.m_block) * BlockSize + lhs_index - rhs_index;
+      difference_type lhs_index = lhs.m_element - *lhs.m_block;
+      difference_type rhs_index = rhs.m_element - *rhs.m_block;
+      return (lhs.m_block - rhs.m_block) *
+                 static_cast<difference_type>(BlockSize) +
+             lhs_index - rhs_index;
     }
     /// Checks whether "lhs" is equal to "rhs".
     friend bool operator==(const DequeIterator &lhs, const DequeIterator &rhs) {
-      return lhs.m_element == rhs.m_element && lhs.m_block == rhs.m_block;
+      return lhs.m_element == rhs.m_element;
     }
     /// Checks whether "lhs" is difference than "rhs".
     friend bool operator!=(const DequeIterator &lhs, const DequeIterator &rhs) {
       return !(lhs == rhs);
     }
+    /// Checks whether "lhs" points before "rhs".
+    friend bool operator<(const DequeIterator &lhs, const DequeIterator &rhs) {
+      return lhs.m_block == rhs.m_block ? lhs.m_element < rhs.m_element
+                                        : lhs.m_block < rhs.m_block;
+    }
+    /// Checks whether "lhs" points after "rhs".
+    friend bool operator>(const DequeIterator &lhs, const DequeIterator &rhs) {
+      return rhs < lhs;
+    }
+    /// Checks whether "lhs" does not point after "rhs".
+    friend bool operator<=(const DequeIterator &lhs, const DequeIterator &rhs) {
+      return !(rhs < lhs);
+    }
+    /// Checks whether "lhs" does not point before "rhs".
+    friend bool operator>=(const DequeIterator &lhs, const DequeIterator &rhs) {
+      return !(lhs < rhs);
+    }
 
   private:
-    BlockItr m_block;     //!< Iterator to the block of the element.
-    ElementItr m_element; //!< Iterator to the element.
+    block_pointer m_block{nullptr}; //!< Pointer to the block in the mob.
+    pointer m_element{nullptr};     //!< Pointer to the element.
   };
 
 private:
@@ -507,20 +549,78 @@ private:
   };
 
   //=== Auxiliary Functions.
+  /*!
+   * Inserts "count" elements before "pos". They are constructed in the raw
+   * slots beyond the closer end of the container, then rotated into place.
+   * \param pos iterator to the element past the position to insert.
+   * \param count number of elements to insert.
+   * \param construct callable that constructs the next element in the raw
+   *        slot it receives.
+   * \return iterator pointing to the first inserted value, or "pos" if none was
+   *         inserted.
+   */
+  template <typename Construct>
+  iterator insert_constructed(iterator pos, size_type count,
+                              Construct construct) {
+    if (count == 0) {
+      return pos;
+    }
+    if (m_mob.empty()) {
+      // Only a moved-from deque has no map, and it is empty.
+      initialize_control_variables();
+      pos = m_head;
+    }
+    difference_type index = pos - m_head;
+    auto range_size = static_cast<difference_type>(count);
+    if (closer_to(pos) == position_e::FRONT) {
+      space_vacancy(position_e::FRONT, count);
+      iterator old_head = m_head;
+      construct_range(m_head - range_size, count, construct);
+      m_head = m_head - range_size;
+      std::rotate(m_head, old_head, old_head + index);
+    } else {
+      space_vacancy(position_e::BACK, count);
+      iterator old_tail = m_tail;
+      construct_range(m_tail, count, construct);
+      m_tail = m_tail + range_size;
+      std::rotate(m_head + index, old_tail, m_tail);
+    }
+    m_size += count;
+    return m_head + index;
+  }
+  /*!
+   * Constructs "count" elements in the raw slots starting at "first". If one
+   * of the constructions throws, the elements already built are destroyed.
+   */
+  template <typename Construct>
+  void construct_range(iterator first, size_type count, Construct &construct) {
+    iterator runner = first;
+    try {
+      for (size_type counter{0}; counter < count; ++counter, ++runner) {
+        construct(runner.get_element_it());
+      }
+    } catch (...) {
+      destroy(first, runner);
+      throw;
+    }
+  }
+  /// Destroys the elements in the range [first, last).
+  void destroy(iterator first, iterator last) {
+    for (; first != last; ++first) {
+      first->~value_type();
+    }
+  }
   /*!
    * Consults the number of vacant spaces in the "position" far side of the
    * block.
    * \param position target side of the block.
    * \return number of spaces vacant in the "position" far side of the block.
    */
-  size_type block_vacancy(position_e position) {
+  size_type block_vacancy(position_e position) const {
     if (position == position_e::FRONT) {
-      return std::distance((*m_head.get_block_it())->begin(),
-                           m_head.get_element_it());
+      return m_head.get_element_it() - *m_head.get_block_it();
     } else {
-      return std::distance(m_tail.get_element_it(),
-                           (*m_tail.get_block_it())->end()) -
-             1;
+      return *m_tail.get_block_it() + BlockSize - m_tail.get_element_it() - 1;
     }
   }
   /*!
@@ -528,33 +628,36 @@ private:
    * \param position target side of the mob.
    * \return number of blocks vacant in the "position" far side of the mob.
    */
-  size_type mob_vacancy(position_e position) {
+  size_type mob_vacancy(position_e position) const {
     if (position == position_e::FRONT) {
-      return std::distance(m_mob.begin(), m_head.get_block_it());
+      return m_head.get_block_it() - m_mob.data();
     } else {
-      return std::distance(m_tail.get_block_it(), m_mob.end()) - 1;
+      return m_mob.data() + m_mob.size() - m_tail.get_block_it() - 1;
     }
   }
   /*!
-   * Assures that at least "count" vacancy spaces exists in the "position" far
-   * side of the container.
+   * Assures that at least "count" vacant slots exist in the "position" far
+   * side of the container. In the back, the tail must also stay inside an
+   * allocated block after the slots are filled.
    * \param position target side of the container.
-   * \param pos iterator to an element in the container.
    * \param count number of spaces that needs to be vacant in the target
    *              position in the container.
-   * \return iterator pointing to the same element "pos" was pointing to.
    */
-  iterator space_vacancy(position_e position, iterator pos, size_type count) {
+  void space_vacancy(position_e position, size_type count) {
     size_type vacancy = block_vacancy(position);
-    difference_type require_blocks =
-        std::ceil((static_cast<float>(count) - vacancy) / BlockSize);
+    if (position == position_e::BACK) {
+      ++vacancy;
+    }
+    size_type require_blocks = 0;
+    if (position == position_e::FRONT && count > vacancy) {
+      require_blocks = (count - vacancy + BlockSize - 1) / BlockSize;
+    } else if (position == position_e::BACK && count >= vacancy) {
+      require_blocks = (count - vacancy) / BlockSize + 1;
+    }
     if (mob_vacancy(position) < require_blocks) {
-      difference_type index = pos - m_head;
-      reallocate_mob(2 * m_size + count);
-      pos = m_head + index;
+      reallocate_mob(position, require_blocks);
     }
     allocate_blocks(position, require_blocks);
-    return pos;
   }
   /*!
    * Guarantees that "count" blocks are allocated in the "position" far side of
@@ -563,47 +666,80 @@ private:
    * \param count number of blocks guarantee to be allocate.
    */
   void allocate_blocks(position_e position, size_type count) {
-    if (position == position_e::FRONT) {
-      auto runner = m_head.get_block_it() - 1;
-      for (size_type counter{0}; counter < count; ++counter, --runner) {
-        if (*runner == nullptr) {
-          *runner = std::make_unique<block_t>();
-        }
-      }
-    } else if (*(++m_tail.get_block_it()) == nullptr) {
-      auto runner = m_tail.get_block_it() + 1;
-      for (size_type counter{0}; counter < count; ++counter, ++runner) {
-        if (*runner == nullptr) {
-          *runner = std::make_unique<block_t>();
-        }
+    size_type index = position == position_e::FRONT
+                          ? m_head.get_block_it() - m_mob.data() - count
+                          : m_tail.get_block_it() - m_mob.data() + 1;
+    for (size_type counter{0}; counter < count; ++counter, ++index) {
+      if (m_mob[index] == nullptr) {
+        m_mob[index] = acquire_block();
       }
     }
   }
   /*!
-   * Reallocates mob to have the capacity to hold at least "new_size" elements.
-   * If mob already has capacity for that, does nothing.
-   * \param new_size minimum capacity that the mob should have.
+   * Makes the mob have at least "count" vacant blocks in the "position" far
+   * side. If the blocks in use, plus the vacant ones, fill at most half of the
+   * mob, they are just moved to its middle. Otherwise the mob is reallocated
+   * with twice the capacity. The spare blocks go to the cache.
+   * \param position side of the mob that needs vacant blocks.
+   * \param count number of vacant blocks needed.
    */
-  void reallocate_mob(size_type new_size) {
-    new_size = std::ceil(static_cast<float>(new_size) / BlockSize);
-    if (new_size > m_mob_capacity) {
-      size_type size_difference = new_size - m_mob_capacity;
-      block_list_t new_mob(new_size);
-      typename block_list_t::iterator new_mob_runner =
-          new_mob.begin() + size_difference / 2;
-      for (typename block_list_t::iterator mob_runner = m_mob.begin();
-           mob_runner != m_mob.end(); ++new_mob_runner, ++mob_runner) {
-        if (mob_runner == m_head.get_block_it()) {
-          m_head = iterator(new_mob_runner, m_head.get_element_it());
-        }
-        if (mob_runner == m_tail.get_block_it()) {
-          m_tail = iterator(new_mob_runner, m_tail.get_element_it());
-        }
-        swap(*new_mob_runner, *mob_runner);
+  void reallocate_mob(position_e position, size_type count) {
+    size_type head_block = m_head.get_block_it() - m_mob.data();
+    size_type tail_block = m_tail.get_block_it() - m_mob.data();
+    size_type used = tail_block - head_block + 1;
+    for (size_type index{0}; index < m_mob.size(); ++index) {
+      if ((index < head_block || index > tail_block) &&
+          m_mob[index] != nullptr) {
+        release_block(index);
       }
-      m_mob = std::move(new_mob);
-      m_mob_capacity = new_size;
     }
+    auto used_begin = m_mob.begin() + head_block;
+    auto used_end = m_mob.begin() + tail_block + 1;
+    size_type first{0};
+    if (2 * (used + count) <= m_mob.size()) {
+      first = (m_mob.size() - used - count) / 2;
+      if (position == position_e::FRONT) {
+        first += count;
+      }
+      if (first < head_block) {
+        std::copy(used_begin, used_end, m_mob.begin() + first);
+      } else {
+        std::copy_backward(used_begin, used_end, m_mob.begin() + first + used);
+      }
+      std::fill(m_mob.begin(), m_mob.begin() + first, nullptr);
+      std::fill(m_mob.begin() + first + used, m_mob.end(), nullptr);
+    } else {
+      size_type new_capacity = std::max(2 * m_mob.size(), used + count);
+      first = (new_capacity - used - count) / 2;
+      if (position == position_e::FRONT) {
+        first += count;
+      }
+      block_list_t new_mob(new_capacity, nullptr);
+      std::copy(used_begin, used_end, new_mob.begin() + first);
+      m_mob.swap(new_mob);
+    }
+    m_head = iterator(m_mob.data() + first, m_head.get_element_it());
+    m_tail = iterator(m_mob.data() + first + used - 1, m_tail.get_element_it());
+  }
+  /// Takes a block from the cache, or allocates a new one if it is empty.
+  pointer acquire_block() {
+    if (!m_free_blocks.empty()) {
+      pointer block = m_free_blocks.back();
+      m_free_blocks.pop_back();
+      return block;
+    }
+    // The cache can always hold every block, so releasing never allocates.
+    if (m_free_blocks.capacity() <= m_blocks) {
+      m_free_blocks.reserve(2 * m_blocks + 1);
+    }
+    pointer block = m_allocator.allocate(BlockSize);
+    ++m_blocks;
+    return block;
+  }
+  /// Moves the block at the "index" position of the mob to the cache.
+  void release_block(size_type index) {
+    m_free_blocks.push_back(m_mob[index]);
+    m_mob[index] = nullptr;
   }
   /*!
    * Checks if iterator "pos", is closer to the end or to the begin of the
@@ -617,39 +753,23 @@ private:
     difference_type to_start = pos - m_head;
     return to_start < to_end ? position_e::FRONT : position_e::BACK;
   }
-  template <class InputIt, class OutputIt>
-  OutputIt copy(InputIt first, InputIt last, OutputIt d_first) {
-    while (first != last) {
-      *(first++) = *(d_first++);
-    }
-    return d_first;
-  }
-  template <class InputIt, class OutputIt>
-  OutputIt copy_backward(InputIt first, InputIt last, OutputIt d_last) {
-    while (first != last) {
-      *(--d_last) = *(--last);
-    }
-    return d_last;
-  }
   /// Initializes container variables.
   void initialize_control_variables() {
     m_size = 0;
-    m_mob_capacity = DefaultMobCapacity;
-    m_mob.resize(m_mob_capacity);
-    typename block_list_t::iterator mob_mid_it =
-        m_mob.begin() + DefaultMobCapacity / 2;
-    *mob_mid_it = std::make_unique<block_t>();
-    typename block_t::iterator block_mid_it =
-        (*mob_mid_it)->begin() + BlockSize / 2;
-    m_head = iterator(mob_mid_it, block_mid_it);
-    m_tail = iterator(mob_mid_it, block_mid_it);
+    m_mob.assign(DefaultMobCapacity, nullptr);
+    size_type middle = DefaultMobCapacity / 2;
+    m_mob[middle] = acquire_block();
+    m_head = iterator(m_mob.data() + middle, m_mob[middle] + BlockSize / 2);
+    m_tail = m_head;
   }
 
-  block_list_t m_mob;       //!< The dynamic map of blocks.
-  size_type m_mob_capacity; //!< Capacity of the mob.
-  size_type m_size;         //!< Number of elements in the container.
-  iterator m_head;          //!< Iterator to the head block.
-  iterator m_tail;          //!< Iterator to the tail block.
+  block_list_t m_mob;                     //!< The dynamic map of blocks.
+  block_list_t m_free_blocks;             //!< Cache of unused blocks.
+  size_type m_blocks{0};                  //!< Number of blocks allocated.
+  size_type m_size{0};                    //!< Number of elements.
+  iterator m_head;                        //!< Iterator to the first element.
+  iterator m_tail;                        //!< Iterator past the last element.
+  std::allocator<value_type> m_allocator; //!< Allocates the blocks.
 };
 } // namespace sc
 
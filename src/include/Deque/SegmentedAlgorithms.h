@@ -0,0 +1,89 @@
+#ifndef SRC_INCLUDE_DEQUE_SEGMENTEDALGORITHMS_H_
+#define SRC_INCLUDE_DEQUE_SEGMENTEDALGORITHMS_H_
+
+#include <algorithm> // copy, find
+
+// Namespace for sequential containers(sc).
+namespace sc {
+/*!
+ * Versions of for_each, copy and find for ranges of sc::deque. A deque stores
+ * its elements in blocks of contiguous memory, so instead of checking for the
+ * end of a block at every step, as the iterator does, they split the range in
+ * the parts that lie in each block and run the std algorithm over plain
+ * pointers for each part, which the compiler can unroll and vectorize.
+ */
+namespace segmented {
+/*!
+ * Calls "segment" with each maximal contiguous part of [first, last), in
+ * order, as a pair of pointers [begin, end).
+ * \param first beginning of the range, a sc::deque iterator.
+ * \param last ending of the range (not included).
+ * \param segment callable receiving the pointers to each part.
+ */
+template <typename DequeIt, typename Segment>
+void for_each_segment(DequeIt first, DequeIt last, Segment segment) {
+  auto block = first.get_block_it();
+  typename DequeIt::pointer element = first.get_element_it();
+  for (; block != last.get_block_it(); ++block, element = *block) {
+    typename DequeIt::pointer end = *block + DequeIt::block_size;
+    segment(element, end);
+  }
+  segment(element, last.get_element_it());
+}
+
+/*!
+ * Applies "function" to every element in [first, last), in order.
+ * \param first beginning of the range, a sc::deque iterator.
+ * \param last ending of the range (not included).
+ * \param function callable to apply to the elements.
+ * \return the function, after being applied to all elements.
+ */
+template <typename DequeIt, typename Function>
+Function for_each(DequeIt first, DequeIt last, Function function) {
+  for_each_segment(first, last, [&function](auto begin, auto end) {
+    for (; begin != end; ++begin) {
+      function(*begin);
+    }
+  });
+  return function;
+}
+
+/*!
+ * Copies the elements in [first, last) to the range starting at "destiny".
+ * \param first beginning of the range, a sc::deque iterator.
+ * \param last ending of the range (not included).
+ * \param destiny beginning of the range to copy to.
+ * \return iterator past the last element copied.
+ */
+template <typename DequeIt, typename OutputIt>
+OutputIt copy(DequeIt first, DequeIt last, OutputIt destiny) {
+  for_each_segment(first, last, [&destiny](auto begin, auto end) {
+    destiny = std::copy(begin, end, destiny);
+  });
+  return destiny;
+}
+
+/*!
+ * Finds the first element equal to "value" in [first, last).
+ * \param first beginning of the range, a sc::deque iterator.
+ * \param last ending of the range (not included).
+ * \param value value to search for.
+ * \return iterator to the first element equal to "value", or "last".
+ */
+template <typename DequeIt, typename T>
+DequeIt find(DequeIt first, DequeIt last, const T &value) {
+  auto block = first.get_block_it();
+  typename DequeIt::pointer element = first.get_element_it();
+  for (; block != last.get_block_it(); ++block, element = *block) {
+    typename DequeIt::pointer end = *block + DequeIt::block_size;
+    auto found = std::find(element, end, value);
+    if (found != end) {
+      return DequeIt(block, found);
+    }
+  }
+  return DequeIt(block, std::find(element, last.get_element_it(), value));
+}
+} // namespace segmented
+} // namespace sc
+
+#endif // SRC_INCLUDE_DEQUE_SEGMENTEDALGORITHMS_H_
@@ -0,0 +1,217 @@
+#ifndef SRC_INCLUDE_DEQUE_WORKSTEALINGDEQUE_H_
+#define SRC_INCLUDE_DEQUE_WORKSTEALINGDEQUE_H_
+
+#include <atomic>      // atomic, atomic_thread_fence, memory_order
+#include <cstddef>     // size_t, ptrdiff_t
+#include <memory>      // unique_ptr, make_unique
+#include <type_traits> // is_trivially_copyable
+#include <vector>
+
+// Namespace for sequential containers(sc).
+namespace sc {
+/*!
+ * Work-stealing double ended queue (Chase and Lev, with the memory orders of
+ * Lê et al.). One thread, the owner, uses the bottom of the deque as a stack
+ * with push_back and pop_back, without locks or read-modify-write operations
+ * unless a single element is left; any other thread may take elements from
+ * the top with steal, which costs one compare-and-swap. Scheduling tasks with
+ * one such deque per thread keeps each thread working on its own recent
+ * tasks, while idle threads take the oldest ones of the others, which are
+ * usually the biggest.
+ *
+ * The elements live in a circular buffer whose capacity is doubled by the
+ * owner when it is full. A thief may still be reading the old buffer, so it is
+ * kept until the deque is destroyed; as the capacities double, the old buffers
+ * take less memory than the current one.
+ * \tparam T data type to store, usually a pointer to a task. Thieves read an
+ *         element before knowing whether they won it, so it must be trivially
+ *         copyable and fit in a lock-free atomic.
+ *
+ * \author Eduardo Marinho (eduardo.nestor.marinho228@gmail.com)
+ */
+template <typename T> class work_stealing_deque {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "work_stealing_deque elements must be trivially copyable");
+  static_assert(std::atomic<T>::is_always_lock_free,
+                "work_stealing_deque elements must fit a lock-free atomic");
+
+public:
+  //=== Aliases.
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  ///=== [I] Special Functions.
+  /*!
+   * Creates a empty deque.
+   * \param capacity initial capacity, rounded up to a power of two.
+   *        Default = 64.
+   */
+  explicit work_stealing_deque(size_type capacity = 64) {
+    size_type rounded{1};
+    while (rounded < capacity) {
+      rounded *= 2;
+    }
+    m_buffers.push_back(std::make_unique<buffer>(rounded));
+    m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+  }
+  work_stealing_deque(const work_stealing_deque &) = delete;
+  work_stealing_deque &operator=(const work_stealing_deque &) = delete;
+  /// Deallocates memory, the current buffer and the retired ones.
+  ~work_stealing_deque() = default;
+
+  ///=== [II] Capacity.
+  /*!
+   * Checks whether the deque is empty. With other threads working on the
+   * deque, the answer may be outdated when it returns.
+   */
+  [[nodiscard]] bool empty() const { return size() == 0; }
+  /*!
+   * Consults the number of elements in the deque. With other threads working
+   * on the deque, the answer may be outdated when it returns.
+   */
+  [[nodiscard]] size_type size() const {
+    difference_type top = m_top.load(std::memory_order_acquire);
+    difference_type bottom = m_bottom.load(std::memory_order_acquire);
+    return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+  }
+  /// Consults the capacity of the current buffer, owner only.
+  size_type capacity() const {
+    return m_buffer.load(std::memory_order_relaxed)->capacity();
+  }
+
+  ///=== [III] Owner Modifiers.
+  /*!
+   * Inserts "value" at the bottom of the deque, doubling the capacity of the
+   * buffer if it is full. Only the owner may call it.
+   * \param value value to insert.
+   */
+  void push_back(const_reference value) {
+    difference_type bottom = m_bottom.load(std::memory_order_relaxed);
+    difference_type top = m_top.load(std::memory_order_acquire);
+    buffer *current = m_buffer.load(std::memory_order_relaxed);
+    if (bottom - top >= static_cast<difference_type>(current->capacity())) {
+      current = grow(current, top, bottom);
+    }
+    current->store(bottom, value);
+    // The element must be visible before the thieves see the new bottom.
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+  /*!
+   * Removes the element at the bottom of the deque, the last one pushed that
+   * was not taken yet. Only the owner may call it.
+   * \param value object to receive the element.
+   * \return true if an element was removed, false if the deque was empty.
+   */
+  bool pop_back(reference value) {
+    difference_type bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    buffer *current = m_buffer.load(std::memory_order_relaxed);
+    // Reserves the bottom element before looking at what the thieves took.
+    m_bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    difference_type top = m_top.load(std::memory_order_relaxed);
+    if (top > bottom) {
+      m_bottom.store(bottom + 1, std::memory_order_relaxed);
+      return false;
+    }
+    value_type element = current->load(bottom);
+    if (top == bottom) {
+      // Last element: races with the thieves for it.
+      bool won = m_top.compare_exchange_strong(top, top + 1,
+                                               std::memory_order_seq_cst,
+                                               std::memory_order_relaxed);
+      m_bottom.store(bottom + 1, std::memory_order_relaxed);
+      if (!won) {
+        return false;
+      }
+    }
+    value = element;
+    return true;
+  }
+
+  ///=== [IV] Thief Modifiers.
+  /*!
+   * Removes the element at the top of the deque, the oldest one. Any thread
+   * may call it.
+   * \param value object to receive the element.
+   * \return true if an element was removed, false if the deque was empty or
+   *         another thread took the element first.
+   */
+  bool steal(reference value) {
+    difference_type top = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    difference_type bottom = m_bottom.load(std::memory_order_acquire);
+    if (top >= bottom) {
+      return false;
+    }
+    // Read before the CAS, the slot may be overwritten right after it.
+    value_type element = m_buffer.load(std::memory_order_acquire)->load(top);
+    if (!m_top.compare_exchange_strong(top, top + 1,
+                                       std::memory_order_seq_cst,
+                                       std::memory_order_relaxed)) {
+      return false;
+    }
+    value = element;
+    return true;
+  }
+
+private:
+  /// Circular array of atomic slots with a power of two capacity.
+  class buffer {
+  public:
+    explicit buffer(size_type capacity)
+        : m_mask{capacity - 1},
+          m_slots{std::make_unique<std::atomic<value_type>[]>(capacity)} {}
+    size_type capacity() const { return m_mask + 1; }
+    /// Reads the slot of "index", which may be read by a thief concurrently.
+    value_type load(difference_type index) const {
+      return slot(index).load(std::memory_order_relaxed);
+    }
+    /// Writes the slot of "index", which may be read by a thief concurrently.
+    void store(difference_type index, const_reference value) {
+      slot(index).store(value, std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<value_type> &slot(difference_type index) const {
+      return m_slots[static_cast<size_type>(index) & m_mask];
+    }
+
+    size_type m_mask;                                 //!< capacity - 1.
+    std::unique_ptr<std::atomic<value_type>[]> m_slots; //!< Slots.
+  };
+
+  /*!
+   * Replaces the buffer with one twice as big holding the same elements.
+   * \param current buffer in use.
+   * \param top index of the first element.
+   * \param bottom index past the last element.
+   * \return the new buffer.
+   */
+  buffer *grow(buffer *current, difference_type top, difference_type bottom) {
+    m_buffers.push_back(std::make_unique<buffer>(current->capacity() * 2));
+    buffer *bigger = m_buffers.back().get();
+    for (difference_type index{top}; index < bottom; ++index) {
+      bigger->store(index, current->load(index));
+    }
+    m_buffer.store(bigger, std::memory_order_release);
+    return bigger;
+  }
+
+  //! Size of the cache lines the indexes are kept apart by.
+  static constexpr size_type cache_line_size = 64;
+
+  //! Index of the oldest element, shared by the owner and the thieves.
+  alignas(cache_line_size) std::atomic<difference_type> m_top{0};
+  //! Index past the newest element, only written by the owner.
+  alignas(cache_line_size) std::atomic<difference_type> m_bottom{0};
+  std::atomic<buffer *> m_buffer; //!< Buffer in use.
+  //! Every buffer the deque used, owner only; the last one is m_buffer.
+  std::vector<std::unique_ptr<buffer>> m_buffers;
+};
+} // namespace sc
+
+#endif // SRC_INCLUDE_DEQUE_WORKSTEALINGDEQUE_H_
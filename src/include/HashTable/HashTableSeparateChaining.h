@@ -163,7 +163,7 @@ public:
   ///=== [IV] Modifiers.
   /// Clears the container, i.e. removes all its elements.
   void clear() {
-    for (list_type list : m_table) {
+    for (list_type &list : m_table) {
       list.clear();
     }
     m_size = 0;
@@ -174,10 +174,10 @@ public:
    * \return iterator to the inserted element.
    */
   iterator insert(const_reference value) {
-    ++m_size;
-    if (load_factor() > m_max_load_factor) {
-      rehash(find_next_prime(m_size));
+    if (m_size + 1 > m_max_load_factor * bucket_count()) {
+      rehash(2 * bucket_count());
     }
+    ++m_size;
     size_type index = hash(value);
     m_table[index].push_front(value);
     return iterator(m_table.begin(), m_table.end(), m_table.begin() + index,
@@ -213,6 +213,7 @@ public:
     iterator following_removed = pos + 1;
     size_type index = hash(*pos);
     m_table[index].erase(pos.m_element);
+    --m_size;
     return following_removed;
   }
   /*!
@@ -238,13 +239,16 @@ public:
   size_type erase(const_reference key) {
     size_type index = hash(key);
     size_type counter{0};
-    for (auto runner = m_table[index].begin(); runner != m_table[index].end();
-         ++runner) {
+    for (auto runner = m_table[index].begin();
+         runner != m_table[index].end();) {
       if (key_equal{}(*runner, key)) {
-        m_table[index].erase(runner);
+        runner = m_table[index].erase(runner);
         ++counter;
+      } else {
+        ++runner;
       }
     }
+    m_size -= counter;
     return counter;
   }
   /// Inserts all elements in "other" into this hash table.
@@ -343,7 +347,7 @@ public:
   ///=== [VII] Hash Policy.
   /// Calculates the average number of elements per bucket
   float load_factor() const {
-    return m_table.size() / static_cast<float>(bucket_count());
+    return m_size / static_cast<float>(bucket_count());
   }
   /// Returns the current max load factor.
   float max_load_factor() const { return m_max_load_factor; }
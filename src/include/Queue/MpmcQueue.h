@@ -0,0 +1,243 @@
+#ifndef SRC_INCLUDE_QUEUE_MPMCQUEUE_H_
+#define SRC_INCLUDE_QUEUE_MPMCQUEUE_H_
+
+#include <atomic>      // atomic, memory_order
+#include <cstddef>     // size_t, ptrdiff_t
+#include <new>         // launder
+#include <thread>      // this_thread::yield
+#include <type_traits> // is_nothrow_constructible, aligned_storage_t
+#include <utility>     // forward, move
+
+// Namespace for sequential container(sc).
+namespace sc {
+/*!
+ * Bounded lock-free queue(FIFO) for any number of producer and consumer
+ * threads, stored in a ring buffer of "Capacity" cells (D. Vyukov's bounded
+ * MPMC queue). Every cell has a sequence number that tells whose turn it is:
+ * a producer may fill the cell at position "p" when its sequence is "p", and
+ * a consumer may empty it when its sequence is "p + 1". The threads claim a
+ * position on the shared enqueue or dequeue index, each one in its own cache
+ * line, and hand the cell over with a release store of the sequence, so
+ * producers only contend with producers and consumers with consumers. The
+ * try_ functions claim a position with a compare-and-swap only if its cell is
+ * ready, while the blocking ones take the next position with a fetch_add,
+ * which is cheaper and never retried, and then wait for its cell.
+ *
+ * Unlike sc::queue there is no front(), because another consumer could remove
+ * the element while it is read; try_pop and pop move the element out instead.
+ * \tparam T data type to store. Its move constructor and move assignment
+ *         must not throw, as a claimed cell must always be filled and emptied.
+ * \tparam Capacity maximum number of elements, must be a power of two.
+ *
+ * \author Eduardo Marinho (eduardo.nestor.marinho228@gmail.com)
+ */
+template <class T, size_t Capacity> class mpmc_queue {
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                "mpmc_queue capacity must be a power of two");
+  static_assert(std::is_nothrow_destructible<T>::value,
+                "mpmc_queue elements must not throw when destroyed");
+  static_assert(std::is_nothrow_move_constructible<T>::value,
+                "mpmc_queue elements must be nothrow move constructible");
+  static_assert(std::is_nothrow_move_assignable<T>::value,
+                "mpmc_queue elements must be nothrow move assignable");
+
+public:
+  //=== Aliases.
+  using value_type = T;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  ///=== [I] Special Functions.
+  /// Creates a empty queue, allocating the storage of all its elements.
+  mpmc_queue() : m_cells{new cell[Capacity]} {
+    for (size_type index{0}; index < Capacity; ++index) {
+      m_cells[index].sequence.store(index, std::memory_order_relaxed);
+    }
+  }
+  mpmc_queue(const mpmc_queue &) = delete;
+  mpmc_queue &operator=(const mpmc_queue &) = delete;
+  /// Destroys the elements left in the queue and deallocates memory.
+  ~mpmc_queue() {
+    size_type tail = m_enqueue.load(std::memory_order_relaxed);
+    for (size_type head = m_dequeue.load(std::memory_order_relaxed);
+         head != tail; ++head) {
+      m_cells[head & mask].element()->~value_type();
+    }
+    delete[] m_cells;
+  }
+
+  ///=== [II] Capacity.
+  /*!
+   * Checks whether the queue is empty. With other threads working on the
+   * queue, the answer may be outdated when it returns.
+   */
+  [[nodiscard]] bool empty() const { return size() == 0; }
+  /*!
+   * Consults the number of elements in the queue, counting the ones that are
+   * being inserted or removed. With other threads working on the queue, the
+   * answer may be outdated when it returns.
+   */
+  [[nodiscard]] size_type size() const {
+    size_type head = m_dequeue.load(std::memory_order_acquire);
+    size_type tail = m_enqueue.load(std::memory_order_acquire);
+    // Waiting threads may have taken positions beyond the ends of the queue.
+    if (tail <= head) {
+      return 0;
+    }
+    return tail - head < Capacity ? tail - head : Capacity;
+  }
+  /// Consults the maximum number of elements the queue can hold.
+  static constexpr size_type capacity() { return Capacity; }
+
+  ///=== [III] Modifiers.
+  /*!
+   * Constructs an element at the back of the queue, if it is not full. When
+   * the constructor may throw, the element is built before a cell is claimed,
+   * so the arguments may have been moved from even if it returns false.
+   * \param args arguments to forward to the constructor of the element.
+   * \return true if the element was inserted, false if the queue was full.
+   */
+  template <class... Args> bool try_emplace(Args &&...args) {
+    if constexpr (std::is_nothrow_constructible<value_type, Args...>::value) {
+      size_type position = m_enqueue.load(std::memory_order_relaxed);
+      cell *target = claim(m_enqueue, position, 0);
+      if (target == nullptr) {
+        return false;
+      }
+      ::new (target->storage()) value_type(std::forward<Args>(args)...);
+      publish(target, position + 1);
+      return true;
+    } else {
+      value_type value(std::forward<Args>(args)...);
+      return try_emplace(std::move(value));
+    }
+  }
+  /// Inserts a copy of "value" at the back of the queue, if it is not full.
+  bool try_push(const_reference value) { return try_emplace(value); }
+  /// Moves "value" to the back of the queue, if it is not full.
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+  /*!
+   * Constructs an element at the back of the queue, waiting while it is full.
+   * The position is taken with a single fetch_add, and then the thread waits
+   * for the cell to be emptied, if needed.
+   * \param args arguments to forward to the constructor of the element.
+   */
+  template <class... Args> void emplace(Args &&...args) {
+    if constexpr (std::is_nothrow_constructible<value_type, Args...>::value) {
+      size_type position = m_enqueue.fetch_add(1, std::memory_order_relaxed);
+      cell *target = wait_for(position, position);
+      ::new (target->storage()) value_type(std::forward<Args>(args)...);
+      publish(target, position + 1);
+    } else {
+      value_type value(std::forward<Args>(args)...);
+      emplace(std::move(value));
+    }
+  }
+  /// Inserts a copy of "value" at the back of the queue, waiting while full.
+  void push(const_reference value) { emplace(value); }
+  /// Moves "value" to the back of the queue, waiting while it is full.
+  void push(value_type &&value) { emplace(std::move(value)); }
+  /*!
+   * Moves the first element of the queue to "value" and removes it, if the
+   * queue is not empty.
+   * \param value object to receive the element.
+   * \return true if an element was removed, false if the queue was empty.
+   */
+  bool try_pop(reference value) {
+    size_type position = m_dequeue.load(std::memory_order_relaxed);
+    cell *target = claim(m_dequeue, position, 1);
+    if (target == nullptr) {
+      return false;
+    }
+    take(target, position, value);
+    return true;
+  }
+  /*!
+   * Moves the first element of the queue to "value" and removes it, waiting
+   * while the queue is empty. The position is taken with a single fetch_add,
+   * and then the thread waits for the cell to be filled, if needed.
+   * \param value object to receive the element.
+   */
+  void pop(reference value) {
+    size_type position = m_dequeue.fetch_add(1, std::memory_order_relaxed);
+    take(wait_for(position, position + 1), position, value);
+  }
+
+private:
+  //! Size of the cache lines the indexes are kept apart by.
+  static constexpr size_type cache_line_size = 64;
+  //! Mask that turns a position into the index of its cell.
+  static constexpr size_type mask = Capacity - 1;
+
+  /// Storage of an element plus the sequence number that guards it.
+  struct cell {
+    std::atomic<size_type> sequence; //!< Position the cell is waiting for.
+    std::aligned_storage_t<sizeof(value_type), alignof(value_type)>
+        data; //!< Raw storage of the element.
+
+    /// Gets the address to construct the element at.
+    void *storage() { return &data; }
+    /// Gets the element constructed in the cell.
+    pointer element() { return std::launder(reinterpret_cast<pointer>(&data)); }
+  };
+
+  /*!
+   * Claims the cell of the first position of "index" whose sequence is
+   * "position + turn", if the cell of the current position is ready.
+   * \param index m_enqueue or m_dequeue.
+   * \param position last value read from "index", receives the claimed one.
+   * \param turn 0 to claim a cell to fill, 1 to claim a cell to empty.
+   * \return the claimed cell, or nullptr if the queue was full or empty.
+   */
+  cell *claim(std::atomic<size_type> &index, size_type &position,
+              size_type turn) {
+    for (;;) {
+      cell *target = &m_cells[position & mask];
+      auto wait = static_cast<difference_type>(
+          target->sequence.load(std::memory_order_acquire) - position - turn);
+      if (wait == 0) {
+        if (index.compare_exchange_weak(position, position + 1,
+                                        std::memory_order_relaxed)) {
+          return target;
+        }
+      } else if (wait < 0) {
+        // The thread of the previous turn of the cell is not done.
+        return nullptr;
+      } else {
+        position = index.load(std::memory_order_relaxed);
+      }
+    }
+  }
+  /// Waits until the cell of "position" has the given sequence.
+  cell *wait_for(size_type position, size_type sequence) {
+    cell *target = &m_cells[position & mask];
+    while (target->sequence.load(std::memory_order_acquire) != sequence) {
+      std::this_thread::yield();
+    }
+    return target;
+  }
+  /// Moves the element out of the cell of "position" and frees the cell.
+  void take(cell *target, size_type position, reference value) {
+    pointer element = target->element();
+    value = std::move(*element);
+    element->~value_type();
+    publish(target, position + Capacity);
+  }
+  /// Hands "target" over to whoever waits for the given sequence.
+  static void publish(cell *target, size_type sequence) {
+    target->sequence.store(sequence, std::memory_order_release);
+  }
+
+  cell *m_cells; //!< Ring buffer of cells.
+  //! Next position to fill, shared by the producers.
+  alignas(cache_line_size) std::atomic<size_type> m_enqueue{0};
+  //! Next position to empty, shared by the consumers.
+  alignas(cache_line_size) std::atomic<size_type> m_dequeue{0};
+};
+} // namespace sc
+
+#endif // SRC_INCLUDE_QUEUE_MPMCQUEUE_H_
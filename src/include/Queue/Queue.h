@@ -1,9 +1,13 @@
 #ifndef SRC_INCLUDE_QUEUE_QUEUE_H_
 #define SRC_INCLUDE_QUEUE_QUEUE_H_
 
-#include <cstddef> // size_t
+#include "Adapter/AdapterTraits.h"
+#include <algorithm> // min, move
+#include <cstddef>   // size_t
 #include <deque>
 #include <initializer_list>
+#include <iterator> // next
+#include <utility>  // move
 
 // Namespace for sequential container(sc).
 namespace sc {
@@ -77,6 +81,77 @@ public:
   void push(const_reference value) { m_container.push_back(value); }
   /// Removes an element from the front of the container.
   void pop() { m_container.pop_front(); }
+  /*!
+   * Inserts the elements in the range [first, last) in the back of the
+   * container, in order. With forward iterators and a container that can
+   * insert a range, as std::deque and sc::deque, it takes a single call.
+   * \param first beginning of the range.
+   * \param last ending of the range (not included).
+   */
+  template <typename InputIt> void push_range(InputIt first, InputIt last) {
+    if constexpr (detail::range_insertable<Container, InputIt>::value) {
+      m_container.insert(m_container.end(), first, last);
+    } else {
+      for (; first != last; ++first) {
+        m_container.push_back(*first);
+      }
+    }
+  }
+  /*!
+   * Moves up to "count" elements from the front of the container to the range
+   * beginning at "destiny", in order, and removes them. With a container that
+   * can erase a range they are removed all at once.
+   * \param destiny beginning of the range to move the elements to.
+   * \param count maximum number of elements to remove.
+   * \return number of elements removed.
+   */
+  template <typename OutputIt>
+  size_type pop_n(OutputIt destiny, size_type count) {
+    size_type removed = std::min(count, size());
+    if constexpr (detail::range_erasable<Container, OutputIt>::value) {
+      auto first = m_container.begin();
+      auto last = std::next(first, removed);
+      std::move(first, last, destiny);
+      m_container.erase(first, last);
+    } else {
+      for (size_type index{0}; index < removed; ++index, ++destiny) {
+        *destiny = std::move(m_container.front());
+        m_container.pop_front();
+      }
+    }
+    return removed;
+  }
+  /*!
+   * Passes every element, from the front to the back, to "callback" as an
+   * rvalue and removes them, leaving the container empty. The callback must
+   * not change the queue. If it throws, the elements it was given, including
+   * the one it threw on, are removed and the others are kept.
+   * \param callback function called with each element.
+   * \return number of elements removed.
+   */
+  template <typename Callback> size_type drain(Callback callback) {
+    size_type removed{0};
+    if constexpr (detail::range_erasable<Container, Callback>::value) {
+      auto first = m_container.begin();
+      auto last = first;
+      try {
+        for (auto end = m_container.end(); last != end; ++removed) {
+          callback(std::move(*last++));
+        }
+      } catch (...) {
+        m_container.erase(first, last);
+        throw;
+      }
+      m_container.erase(first, last);
+    } else {
+      for (; !empty(); ++removed) {
+        value_type value(std::move(m_container.front()));
+        m_container.pop_front();
+        callback(std::move(value));
+      }
+    }
+    return removed;
+  }
 
 private:
   Container m_container; //!< Container that stores the data.
@@ -0,0 +1,238 @@
+#ifndef SRC_INCLUDE_QUEUE_SPSCQUEUE_H_
+#define SRC_INCLUDE_QUEUE_SPSCQUEUE_H_
+
+#include <atomic>      // atomic, memory_order
+#include <cstddef>     // size_t
+#include <memory>      // allocator, allocator_traits
+#include <thread>      // this_thread::yield
+#include <type_traits> // is_nothrow_destructible
+#include <utility>     // forward, move
+
+// Namespace for sequential container(sc).
+namespace sc {
+/*!
+ * Bounded lock-free queue(FIFO) for one producer thread and one consumer
+ * thread, stored in a ring buffer of "Capacity" elements. Only one thread may
+ * call the producer functions (push, emplace and the try_ versions of them)
+ * and only one other thread may call the consumer ones (front, pop and
+ * try_pop) at the same time; empty(), size() and capacity() may be called
+ * from both.
+ *
+ * The producer owns "tail" and the consumer owns "head", each in its own
+ * cache line with a cached copy of the other index, so that a thread only
+ * reads the index of the other one when its cached copy says the queue is
+ * full or empty. The elements are published with release stores and read
+ * after acquire loads, no lock or read-modify-write operation is used. The
+ * range versions of try_push and try_pop move many elements with a single
+ * store of the index.
+ * \tparam T data type to store.
+ * \tparam Capacity maximum number of elements, must be a power of two.
+ *
+ * \author Eduardo Marinho (eduardo.nestor.marinho228@gmail.com)
+ */
+template <class T, size_t Capacity> class spsc_queue {
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                "spsc_queue capacity must be a power of two");
+  static_assert(std::is_nothrow_destructible<T>::value,
+                "spsc_queue elements must not throw when destroyed");
+
+public:
+  //=== Aliases.
+  using value_type = T;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  ///=== [I] Special Functions.
+  /// Creates a empty queue, allocating the storage of all its elements.
+  spsc_queue() : m_buffer{allocator_traits::allocate(m_allocator, Capacity)} {}
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+  /// Destroys the elements left in the queue and deallocates memory.
+  ~spsc_queue() {
+    size_type tail = m_tail.load(std::memory_order_relaxed);
+    for (size_type head = m_head.load(std::memory_order_relaxed); head != tail;
+         ++head) {
+      allocator_traits::destroy(m_allocator, slot(head));
+    }
+    allocator_traits::deallocate(m_allocator, m_buffer, Capacity);
+  }
+
+  ///=== [II] Element Access.
+  /*!
+   * Gets a reference to the first element, consumer only. The queue must not
+   * be empty.
+   */
+  reference front() {
+    return *slot(m_head.load(std::memory_order_relaxed));
+  }
+  /*!
+   * Gets a constant reference to the first element, consumer only. The queue
+   * must not be empty.
+   */
+  const_reference front() const {
+    return *slot(m_head.load(std::memory_order_relaxed));
+  }
+
+  ///=== [III] Capacity.
+  /*!
+   * Checks whether the queue is empty. Unless called by the consumer while
+   * the producer is idle, the answer may be outdated when it returns.
+   */
+  [[nodiscard]] bool empty() const { return size() == 0; }
+  /*!
+   * Consults the number of elements in the queue. Unless called by the
+   * consumer while the producer is idle, the answer may be outdated when it
+   * returns.
+   */
+  [[nodiscard]] size_type size() const {
+    size_type head = m_head.load(std::memory_order_acquire);
+    return m_tail.load(std::memory_order_acquire) - head;
+  }
+  /// Consults the maximum number of elements the queue can hold.
+  static constexpr size_type capacity() { return Capacity; }
+
+  ///=== [IV] Producer Modifiers.
+  /*!
+   * Constructs an element at the back of the queue, if it is not full.
+   * \param args arguments to forward to the constructor of the element.
+   * \return true if the element was inserted, false if the queue was full.
+   */
+  template <class... Args> bool try_emplace(Args &&...args) {
+    size_type tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_cached_head == Capacity) {
+      m_cached_head = m_head.load(std::memory_order_acquire);
+      if (tail - m_cached_head == Capacity) {
+        return false;
+      }
+    }
+    allocator_traits::construct(m_allocator, slot(tail),
+                                std::forward<Args>(args)...);
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+  /// Inserts a copy of "value" at the back of the queue, if it is not full.
+  bool try_push(const_reference value) { return try_emplace(value); }
+  /// Moves "value" to the back of the queue, if it is not full.
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+  /*!
+   * Inserts the elements of [first, last) at the back of the queue, as many as
+   * fit, and makes them visible to the consumer all at once.
+   * \param first beginning of the range.
+   * \param last ending of the range (not included).
+   * \return iterator to the first element that was not inserted.
+   */
+  template <typename InputIt> InputIt try_push(InputIt first, InputIt last) {
+    size_type tail = m_tail.load(std::memory_order_relaxed);
+    size_type position = tail;
+    for (; first != last; ++first, ++position) {
+      if (position - m_cached_head == Capacity) {
+        m_cached_head = m_head.load(std::memory_order_acquire);
+        if (position - m_cached_head == Capacity) {
+          break;
+        }
+      }
+      try {
+        allocator_traits::construct(m_allocator, slot(position), *first);
+      } catch (...) {
+        // Publishes what was constructed, so that nothing is lost.
+        m_tail.store(position, std::memory_order_release);
+        throw;
+      }
+    }
+    if (position != tail) {
+      m_tail.store(position, std::memory_order_release);
+    }
+    return first;
+  }
+  /*!
+   * Constructs an element at the back of the queue, waiting while it is full.
+   * \param args arguments to forward to the constructor of the element.
+   */
+  template <class... Args> void emplace(Args &&...args) {
+    while (!try_emplace(std::forward<Args>(args)...)) {
+      std::this_thread::yield();
+    }
+  }
+  /// Inserts a copy of "value" at the back of the queue, waiting while full.
+  void push(const_reference value) { emplace(value); }
+  /// Moves "value" to the back of the queue, waiting while it is full.
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  ///=== [V] Consumer Modifiers.
+  /// Removes the first element of the queue, which must not be empty.
+  void pop() {
+    size_type head = m_head.load(std::memory_order_relaxed);
+    allocator_traits::destroy(m_allocator, slot(head));
+    m_head.store(head + 1, std::memory_order_release);
+  }
+  /*!
+   * Moves the first element of the queue to "value" and removes it, if the
+   * queue is not empty.
+   * \param value object to receive the element.
+   * \return true if an element was removed, false if the queue was empty.
+   */
+  bool try_pop(reference value) {
+    size_type head = m_head.load(std::memory_order_relaxed);
+    if (head == m_cached_tail) {
+      m_cached_tail = m_tail.load(std::memory_order_acquire);
+      if (head == m_cached_tail) {
+        return false;
+      }
+    }
+    value = std::move(*slot(head));
+    allocator_traits::destroy(m_allocator, slot(head));
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+  /*!
+   * Moves up to "count" elements from the front of the queue to the range
+   * beginning at "destiny" and removes them, freeing their slots to the
+   * producer all at once.
+   * \param destiny beginning of the range to move the elements to.
+   * \param count maximum number of elements to remove.
+   * \return number of elements removed.
+   */
+  template <typename OutputIt>
+  size_type try_pop(OutputIt destiny, size_type count) {
+    size_type head = m_head.load(std::memory_order_relaxed);
+    if (m_cached_tail - head < count) {
+      m_cached_tail = m_tail.load(std::memory_order_acquire);
+    }
+    size_type available = m_cached_tail - head;
+    size_type removed = available < count ? available : count;
+    for (size_type index{0}; index < removed; ++index, ++destiny) {
+      *destiny = std::move(*slot(head + index));
+      allocator_traits::destroy(m_allocator, slot(head + index));
+    }
+    if (removed > 0) {
+      m_head.store(head + removed, std::memory_order_release);
+    }
+    return removed;
+  }
+
+private:
+  //! Size of the cache lines the indexes are kept apart by.
+  static constexpr size_type cache_line_size = 64;
+  using allocator_traits = std::allocator_traits<std::allocator<value_type>>;
+
+  /// Gets the slot of the buffer for the element at "index".
+  pointer slot(size_type index) const {
+    return m_buffer + (index & (Capacity - 1));
+  }
+
+  std::allocator<value_type> m_allocator; //!< Allocator of the buffer.
+  pointer m_buffer; //!< Ring buffer with the storage of the elements.
+  //! Index of the first element, only written by the consumer.
+  alignas(cache_line_size) std::atomic<size_type> m_head{0};
+  size_type m_cached_tail{0}; //!< Consumer's copy of the last read tail.
+  //! Index past the last element, only written by the producer.
+  alignas(cache_line_size) std::atomic<size_type> m_tail{0};
+  size_type m_cached_head{0}; //!< Producer's copy of the last read head.
+};
+} // namespace sc
+
+#endif // SRC_INCLUDE_QUEUE_SPSCQUEUE_H_
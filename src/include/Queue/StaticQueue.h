@@ -0,0 +1,103 @@
+#ifndef SRC_INCLUDE_QUEUE_STATICQUEUE_H_
+#define SRC_INCLUDE_QUEUE_STATICQUEUE_H_
+
+#include "Adapter/StaticStorage.h"
+#include <cstddef>   // size_t, ptrdiff_t
+#include <stdexcept> // length_error
+#include <utility>   // forward, move
+
+// Namespace for sequential container(sc).
+namespace sc {
+/*!
+ * Queue(FIFO) with room for N elements stored inside the object itself, in a
+ * ring buffer, so it never allocates. It has the same interface as sc::queue,
+ * plus full() and capacity().
+ *
+ * For trivially copyable and trivially default constructible types the
+ * elements are kept in a plain array and every member function is constexpr,
+ * so the queue can be used in compile-time evaluation; creating it then
+ * value-initializes the N slots, which costs O(N). Other types are kept in raw
+ * storage and only constructed when pushed.
+ * \tparam T data type to store.
+ * \tparam N maximum number of elements.
+ *
+ * \author Eduardo Marinho (eduardo.nestor.marinho228@gmail.com)
+ */
+template <class T, size_t N> class static_queue {
+  static_assert(N > 0, "static_queue capacity must not be zero");
+
+public:
+  //=== Aliases.
+  using value_type = T;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  ///=== [I] Special Functions.
+  /// Creates a empty queue. The copy, move and destructor are the storage's.
+  constexpr static_queue() = default;
+
+  ///=== [II] Element Access.
+  /// Gets a reference to the first element in the queue.
+  constexpr reference front() { return m_storage.element(m_storage.head); }
+  /// Gets a constant reference to the first element in the queue.
+  constexpr const_reference front() const {
+    return m_storage.element(m_storage.head);
+  }
+  /// Gets a reference to the last element in the queue.
+  constexpr reference back() { return m_storage.element(last()); }
+  /// Gets a constant reference to the last element in the queue.
+  constexpr const_reference back() const { return m_storage.element(last()); }
+
+  ///=== [III] Capacity.
+  /// Checks whether the queue is empty.
+  [[nodiscard]] constexpr bool empty() const { return m_storage.size == 0; }
+  /// Checks whether the queue is full, so that push would throw.
+  [[nodiscard]] constexpr bool full() const { return m_storage.size == N; }
+  /// Consults the number of elements in the queue.
+  [[nodiscard]] constexpr size_type size() const { return m_storage.size; }
+  /// Consults the maximum number of elements the queue can hold.
+  static constexpr size_type capacity() { return N; }
+
+  ///=== [IV] Modifiers.
+  /*!
+   * Constructs an element in place in the back of the queue.
+   * \param args arguments to forward to the constructor of the element.
+   * \return reference to the inserted element.
+   * \throw std::length_error if the queue is full.
+   */
+  template <class... Args> constexpr reference emplace(Args &&...args) {
+    if (full()) {
+      throw std::length_error("static_queue is full");
+    }
+    size_type index = m_storage.wrap(m_storage.head + m_storage.size);
+    m_storage.construct(index, std::forward<Args>(args)...);
+    ++m_storage.size;
+    return m_storage.element(index);
+  }
+  /// Inserts the given element in the back of the queue, see emplace.
+  constexpr void push(const_reference value) { emplace(value); }
+  /// Inserts the given element in the back of the queue, moving it.
+  constexpr void push(value_type &&value) { emplace(std::move(value)); }
+  /// Removes the element in the front of the queue, which must not be empty.
+  constexpr void pop() {
+    m_storage.destroy(m_storage.head);
+    m_storage.head = m_storage.wrap(m_storage.head + 1);
+    --m_storage.size;
+  }
+
+private:
+  /// Gets the index of the slot of the last element.
+  constexpr size_type last() const {
+    return m_storage.wrap(m_storage.head + m_storage.size - 1);
+  }
+
+  //! Storage of the elements of the queue.
+  detail::static_storage<value_type, N> m_storage;
+};
+} // namespace sc
+
+#endif // SRC_INCLUDE_QUEUE_STATICQUEUE_H_
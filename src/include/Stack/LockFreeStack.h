@@ -0,0 +1,219 @@
+#ifndef SRC_INCLUDE_STACK_LOCKFREESTACK_H_
+#define SRC_INCLUDE_STACK_LOCKFREESTACK_H_
+
+#include <algorithm>  // binary_search, sort
+#include <atomic>     // atomic, memory_order
+#include <cstddef>    // size_t, ptrdiff_t
+#include <functional> // hash
+#include <thread>     // thread::id, this_thread
+#include <utility>    // forward, move
+
+// Namespace for sequential container(sc).
+namespace sc {
+/*!
+ * Lock-free stack(LIFO) for any number of threads (R. K. Treiber's stack): a
+ * singly linked list whose head is replaced with a compare-and-swap.
+ *
+ * The nodes removed by try_pop are reclaimed with hazard pointers (M. Michael).
+ * Before reading the head node, a thread publishes its address in a hazard
+ * slot of the stack and checks that it still is the head; removed nodes are
+ * retired to a list of that slot and only deleted when no slot refers to
+ * them. This keeps a thread from reading a deleted node, and, as a node cannot
+ * be reused while a thread that may compare against it protects it, it also
+ * prevents the ABA problem of the compare-and-swap.
+ *
+ * Unlike sc::stack there is no top(), because another thread could remove
+ * the element while it is read; try_pop moves the element out instead.
+ * \tparam T type of data to store.
+ * \tparam HazardSlots number of threads that may be inside try_pop at the
+ *         same time; more threads wait for a free slot. Default = 64.
+ *
+ * \author Eduardo Marinho (eduardo.nestor.marinho228@gmail.com)
+ */
+template <class T, size_t HazardSlots = 64> class lock_free_stack {
+  static_assert(HazardSlots > 0, "lock_free_stack needs a hazard slot");
+
+public:
+  //=== Aliases.
+  using value_type = T;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  ///=== [I] Special Functions.
+  /// Creates a empty stack.
+  lock_free_stack() = default;
+  lock_free_stack(const lock_free_stack &) = delete;
+  lock_free_stack &operator=(const lock_free_stack &) = delete;
+  /// Deletes the elements left and the retired nodes. No thread may use it.
+  ~lock_free_stack() {
+    delete_list(m_head.load(std::memory_order_relaxed), &node::next);
+    for (auto &slot : m_slots) {
+      delete_list(slot.retired, &node::next_retired);
+    }
+  }
+
+  ///=== [II] Capacity.
+  /*!
+   * Checks whether the stack is empty. With other threads working on the
+   * stack, the answer may be outdated when it returns.
+   */
+  [[nodiscard]] bool empty() const {
+    return m_head.load(std::memory_order_acquire) == nullptr;
+  }
+
+  ///=== [III] Modifiers.
+  /*!
+   * Constructs an element in place on the top of the stack.
+   * \param args arguments to forward to the constructor of the element.
+   */
+  template <class... Args> void emplace(Args &&...args) {
+    node *inserted = new node{value_type(std::forward<Args>(args)...)};
+    inserted->next = m_head.load(std::memory_order_relaxed);
+    while (!m_head.compare_exchange_weak(inserted->next, inserted,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed)) {
+    }
+  }
+  /// Inserts the given element on the top of the stack.
+  void push(const_reference value) { emplace(value); }
+  /// Inserts the given element on the top of the stack, moving it.
+  void push(value_type &&value) { emplace(std::move(value)); }
+  /*!
+   * Moves the element on the top of the stack to "value" and removes it, if
+   * the stack is not empty.
+   * \param value object to receive the element.
+   * \return true if an element was removed, false if the stack was empty.
+   */
+  bool try_pop(reference value) {
+    hazard_slot &slot = acquire_slot();
+    node *top = m_head.load(std::memory_order_acquire);
+    for (;;) {
+      if (top == nullptr) {
+        slot.in_use.store(false, std::memory_order_release);
+        return false;
+      }
+      // The node is safe to read only if it was still the head after the
+      // hazard pointer became visible to the threads that reclaim nodes.
+      slot.hazard.store(top, std::memory_order_seq_cst);
+      node *current = m_head.load(std::memory_order_seq_cst);
+      if (current != top) {
+        top = current;
+        continue;
+      }
+      // Sequentially consistent, so the hazard scan of a later reclamation
+      // is ordered after the unlink and sees every thread still reading it.
+      if (m_head.compare_exchange_strong(top, top->next,
+                                         std::memory_order_seq_cst,
+                                         std::memory_order_acquire)) {
+        break;
+      }
+    }
+    slot.hazard.store(nullptr, std::memory_order_release);
+    value = std::move(top->value);
+    retire(slot, top);
+    slot.in_use.store(false, std::memory_order_release);
+    return true;
+  }
+
+private:
+  /// Element of the stack, also linked in a retired list once removed.
+  struct node {
+    value_type value;            //!< Data stored.
+    node *next{nullptr};         //!< Node below, fixed once pushed.
+    node *next_retired{nullptr}; //!< Next node in the retired list.
+  };
+
+  //! Size of the cache lines the hazard slots are kept apart by.
+  static constexpr size_type cache_line_size = 64;
+  //! Number of nodes in a retired list that triggers a reclamation.
+  static constexpr size_type reclaim_threshold = 2 * HazardSlots;
+
+  /*!
+   * Hazard pointer of a thread inside try_pop, alone in its cache line. The
+   * nodes the owners of the slot removed are kept in its retired list, which
+   * only the current owner touches, so retiring a node costs no atomic
+   * operation.
+   */
+  struct alignas(cache_line_size) hazard_slot {
+    std::atomic<bool> in_use{false};     //!< Whether a thread owns it.
+    std::atomic<node *> hazard{nullptr}; //!< Node that must not be freed.
+    node *retired{nullptr};              //!< Removed nodes not deleted yet.
+    size_type retired_count{0};          //!< Number of nodes in "retired".
+  };
+
+  /// Takes a free hazard slot, starting at one chosen by the thread's id.
+  hazard_slot &acquire_slot() {
+    thread_local const size_type hint =
+        std::hash<std::thread::id>{}(std::this_thread::get_id());
+    for (size_type attempt{0};; ++attempt) {
+      hazard_slot &slot = m_slots[(hint + attempt) % HazardSlots];
+      if (!slot.in_use.load(std::memory_order_relaxed) &&
+          !slot.in_use.exchange(true, std::memory_order_acquire)) {
+        return slot;
+      }
+      if (attempt % HazardSlots == HazardSlots - 1) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  /// Adds a removed node to the retired list of "slot", reclaiming if full.
+  void retire(hazard_slot &slot, node *removed) {
+    removed->next_retired = slot.retired;
+    slot.retired = removed;
+    if (++slot.retired_count == reclaim_threshold) {
+      reclaim(slot);
+    }
+  }
+
+  /*!
+   * Deletes the nodes of the retired list of "slot" no hazard pointer refers
+   * to; the others stay in the list for the next reclamation. As every slot
+   * holds at most one hazard pointer, at least half of the nodes go.
+   */
+  void reclaim(hazard_slot &slot) {
+    node *hazards[HazardSlots];
+    size_type hazard_count{0};
+    for (auto &other : m_slots) {
+      node *hazard = other.hazard.load(std::memory_order_seq_cst);
+      if (hazard != nullptr) {
+        hazards[hazard_count++] = hazard;
+      }
+    }
+    std::sort(hazards, hazards + hazard_count);
+    node *retired = slot.retired;
+    slot.retired = nullptr;
+    slot.retired_count = 0;
+    while (retired != nullptr) {
+      node *next = retired->next_retired;
+      if (std::binary_search(hazards, hazards + hazard_count, retired)) {
+        retired->next_retired = slot.retired;
+        slot.retired = retired;
+        ++slot.retired_count;
+      } else {
+        delete retired;
+      }
+      retired = next;
+    }
+  }
+
+  /// Deletes every node of the list starting at "first" linked by "link".
+  static void delete_list(node *first, node *node::*link) {
+    while (first != nullptr) {
+      node *next = first->*link;
+      delete first;
+      first = next;
+    }
+  }
+
+  //! Top of the stack, shared by every thread.
+  alignas(cache_line_size) std::atomic<node *> m_head{nullptr};
+  hazard_slot m_slots[HazardSlots]; //!< Hazard pointers and retired nodes.
+};
+} // namespace sc
+
+#endif // SRC_INCLUDE_STACK_LOCKFREESTACK_H_
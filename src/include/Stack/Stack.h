@@ -1,23 +1,32 @@
 #ifndef SRC_INCLUDE_STACK_STACK_H_
 #define SRC_INCLUDE_STACK_STACK_H_
 
-#include <cstddef> // size_t, ptrdiff_t
-#include <deque>
+#include "Adapter/AdapterTraits.h"
+#include "Vector/Vector.h"
+#include <algorithm> // min, move
+#include <cstddef>   // size_t, ptrdiff_t
 #include <initializer_list>
+#include <iterator> // prev
+#include <utility>  // forward, move
 
 // Namespace for sequential container(sc).
 namespace sc {
 /*!
  * Container adapter that provides the functionality of a stack(LIFO). Acts as a
  * wrapper to the underlying container.
+ *
+ * The default container is sc::vector: a stack only works on its back, so a
+ * contiguous buffer makes push and pop an index update plus a construction or
+ * destruction, with no block bookkeeping as in std::deque, and once it has
+ * grown to the deepest level it never allocates again.
  * \tparam T type of data to store.
  * \tparam Container type of the underlying container to store the data. The
  *         container must satisfy the requirements of a Sequence Container.
- *         Default = std::deque.
+ *         Default = sc::vector.
  *
  * \author Eduardo Marinho (eduardo.nestor.marinho228@gmail.com)
  */
-template <class T, class Container = std::deque<T>> class stack {
+template <class T, class Container = sc::vector<T>> class stack {
 public:
   //=== Aliases.
   using value_type = T;
@@ -33,7 +42,9 @@ public:
   /// Creates a empty container.
   stack() = default;
   /// Make this be a copy of "other".
-  stack(stack_reference other) = default;
+  stack(const stack &other) = default;
+  /// Takes the elements of "other", which is left in a valid state.
+  stack(stack &&other) = default;
   /*!
    * Makes this contain the same data stored in the range [begin, end).
    * \param begin beginning of the range.
@@ -52,9 +63,9 @@ public:
   /// Deallocates memory.
   ~stack() = default;
   /// Makes this be a copy of "other".
-  stack_reference operator=(stack_reference other) {
-    m_container = other.m_container;
-  }
+  stack_reference operator=(const stack &other) = default;
+  /// Takes the elements of "other", which is left in a valid state.
+  stack_reference operator=(stack &&other) = default;
 
   ///=== [II] Element Access.
   /// Gets a reference to the last element in the container.
@@ -64,15 +75,107 @@ public:
 
   ///=== [III] Capacity.
   /// Checks whether the container is empty.
-  [[nodiscard]] bool empty() { return size() == 0; }
+  [[nodiscard]] bool empty() const { return size() == 0; }
   /// Consults the number of elements in the container.
-  [[nodiscard]] size_type size() { return m_container.size(); }
+  [[nodiscard]] size_type size() const { return m_container.size(); }
+  /*!
+   * Reserves storage for "new_capacity" elements in the underlying container,
+   * so that the stack can grow up to that size without allocating. Only
+   * available when the container has reserve(), as sc::vector.
+   * \param new_capacity number of elements to reserve storage for.
+   */
+  void reserve(size_type new_capacity) { m_container.reserve(new_capacity); }
 
   ///=== [IV] Modifiers.
   /// Inserts the given element in the back of the container.
   void push(const_reference value) { m_container.push_back(value); }
+  /// Inserts the given element in the back of the container, moving it.
+  void push(value_type &&value) { m_container.push_back(std::move(value)); }
+  /*!
+   * Constructs an element in place in the back of the container.
+   * \param args arguments to forward to the constructor of the element.
+   * \return reference to the inserted element.
+   */
+  template <class... Args> decltype(auto) emplace(Args &&...args) {
+    return m_container.emplace_back(std::forward<Args>(args)...);
+  }
   /// Removes an element from the back of the container.
   void pop() { m_container.pop_back(); }
+  /*!
+   * Inserts the elements in the range [first, last) in the back of the
+   * container, in order, so "last - 1" ends on the top. With forward iterators
+   * and a container that can insert a range, as sc::vector, it takes a single
+   * call, which allocates at most once.
+   * \param first beginning of the range.
+   * \param last ending of the range (not included).
+   */
+  template <typename InputIt> void push_range(InputIt first, InputIt last) {
+    if constexpr (detail::range_insertable<Container, InputIt>::value) {
+      m_container.insert(m_container.end(), first, last);
+    } else {
+      for (; first != last; ++first) {
+        m_container.push_back(*first);
+      }
+    }
+  }
+  /*!
+   * Moves up to "count" elements from the top of the stack to the range
+   * beginning at "destiny", in the order pop would remove them, and removes
+   * them. With a container that can erase a range they are removed all at
+   * once.
+   * \param destiny beginning of the range to move the elements to.
+   * \param count maximum number of elements to remove.
+   * \return number of elements removed.
+   */
+  template <typename OutputIt>
+  size_type pop_n(OutputIt destiny, size_type count) {
+    size_type removed = std::min(count, size());
+    if constexpr (detail::range_erasable<Container, OutputIt>::value) {
+      auto last = m_container.end();
+      auto first = std::prev(last, removed);
+      for (auto current = last; current != first; ++destiny) {
+        *destiny = std::move(*--current);
+      }
+      m_container.erase(first, last);
+    } else {
+      for (size_type index{0}; index < removed; ++index, ++destiny) {
+        *destiny = std::move(m_container.back());
+        m_container.pop_back();
+      }
+    }
+    return removed;
+  }
+  /*!
+   * Passes every element, from the top to the bottom, to "callback" as an
+   * rvalue and removes them, leaving the container empty. The callback must
+   * not change the stack. If it throws, the elements it was given, including
+   * the one it threw on, are removed and the others are kept.
+   * \param callback function called with each element.
+   * \return number of elements removed.
+   */
+  template <typename Callback> size_type drain(Callback callback) {
+    size_type removed{0};
+    if constexpr (detail::range_erasable<Container, Callback>::value) {
+      auto last = m_container.end();
+      auto first = last;
+      try {
+        for (auto begin = m_container.begin(); first != begin; ++removed) {
+          callback(std::move(*--first));
+        }
+      } catch (...) {
+        m_container.erase(first, last);
+        throw;
+      }
+      m_container.erase(first, last);
+    } else {
+      for (; !empty(); ++removed) {
+        value_type value(std::move(m_container.back()));
+        m_container.pop_back();
+        callback(std::move(value));
+      }
+    }
+    return removed;
+  }
 
 private:
   Container m_container; //!< Container that stores the data.
@@ -0,0 +1,88 @@
+#ifndef SRC_INCLUDE_STACK_STATICSTACK_H_
+#define SRC_INCLUDE_STACK_STATICSTACK_H_
+
+#include "Adapter/StaticStorage.h"
+#include <cstddef>   // size_t, ptrdiff_t
+#include <stdexcept> // length_error
+#include <utility>   // forward, move
+
+// Namespace for sequential container(sc).
+namespace sc {
+/*!
+ * Stack(LIFO) with room for N elements stored inside the object itself, so it
+ * never allocates. It has the same interface as sc::stack, plus full() and
+ * capacity().
+ *
+ * For trivially copyable and trivially default constructible types the
+ * elements are kept in a plain array and every member function is constexpr,
+ * so the stack can be used in compile-time evaluation; creating it then
+ * value-initializes the N slots, which costs O(N). Other types are kept in raw
+ * storage and only constructed when pushed.
+ * \tparam T type of data to store.
+ * \tparam N maximum number of elements.
+ *
+ * \author Eduardo Marinho (eduardo.nestor.marinho228@gmail.com)
+ */
+template <class T, size_t N> class static_stack {
+  static_assert(N > 0, "static_stack capacity must not be zero");
+
+public:
+  //=== Aliases.
+  using value_type = T;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  ///=== [I] Special Functions.
+  /// Creates a empty stack. The copy, move and destructor are the storage's.
+  constexpr static_stack() = default;
+
+  ///=== [II] Element Access.
+  /// Gets a reference to the last element in the stack.
+  constexpr reference top() { return m_storage.element(m_storage.size - 1); }
+  /// Gets a constant reference to the last element in the stack.
+  constexpr const_reference top() const {
+    return m_storage.element(m_storage.size - 1);
+  }
+
+  ///=== [III] Capacity.
+  /// Checks whether the stack is empty.
+  [[nodiscard]] constexpr bool empty() const { return m_storage.size == 0; }
+  /// Checks whether the stack is full, so that push would throw.
+  [[nodiscard]] constexpr bool full() const { return m_storage.size == N; }
+  /// Consults the number of elements in the stack.
+  [[nodiscard]] constexpr size_type size() const { return m_storage.size; }
+  /// Consults the maximum number of elements the stack can hold.
+  static constexpr size_type capacity() { return N; }
+
+  ///=== [IV] Modifiers.
+  /*!
+   * Constructs an element in place on the top of the stack.
+   * \param args arguments to forward to the constructor of the element.
+   * \return reference to the inserted element.
+   * \throw std::length_error if the stack is full.
+   */
+  template <class... Args> constexpr reference emplace(Args &&...args) {
+    if (full()) {
+      throw std::length_error("static_stack is full");
+    }
+    m_storage.construct(m_storage.size, std::forward<Args>(args)...);
+    return m_storage.element(m_storage.size++);
+  }
+  /// Inserts the given element on the top of the stack, see emplace.
+  constexpr void push(const_reference value) { emplace(value); }
+  /// Inserts the given element on the top of the stack, moving it.
+  constexpr void push(value_type &&value) { emplace(std::move(value)); }
+  /// Removes the element on the top of the stack, which must not be empty.
+  constexpr void pop() { m_storage.destroy(--m_storage.size); }
+
+private:
+  //! Storage of the elements of the stack.
+  detail::static_storage<value_type, N> m_storage;
+};
+} // namespace sc
+
+#endif // SRC_INCLUDE_STACK_STATICSTACK_H_
@@ -0,0 +1,221 @@
+#ifndef SRC_INCLUDE_VECTOR_ARRAYOPERATIONS_H_
+#define SRC_INCLUDE_VECTOR_ARRAYOPERATIONS_H_
+
+#include <algorithm>   // max, min, move, move_backward
+#include <cstddef>     // size_t
+#include <cstring>     // memcpy, memmove
+#include <memory>      // allocator_traits
+#include <type_traits> // is_trivially_copyable, is_trivially_destructible
+#include <utility>     // move, move_if_noexcept
+
+// Namespace for sequential containers(sc).
+namespace sc {
+/*
+ * Operations on the elements of a contiguous buffer, shared by sc::vector and
+ * sc::small_vector. The elements are constructed and destroyed with "alloc",
+ * the allocator of the container, whose pointer type must be a raw pointer.
+ */
+namespace detail {
+/// Destroys the elements in the range [first, last) with "alloc".
+template <class Allocator, typename T>
+void destroy(Allocator &alloc, T *first, T *last) {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    for (; first != last; ++first) {
+      std::allocator_traits<Allocator>::destroy(alloc, first);
+    }
+  }
+}
+/*!
+ * Constructs "count" copies of "value" in the memory starting at "destiny". If
+ * a copy throws, the copies already constructed are destroyed.
+ */
+template <class Allocator, typename T>
+void construct_fill(Allocator &alloc, T *destiny, size_t count,
+                    const T &value) {
+  size_t index{0};
+  try {
+    for (; index < count; ++index) {
+      std::allocator_traits<Allocator>::construct(alloc, destiny + index,
+                                                  value);
+    }
+  } catch (...) {
+    detail::destroy(alloc, destiny, destiny + index);
+    throw;
+  }
+}
+/*!
+ * Copies the range [first, last) to the memory starting at "destiny". If a
+ * copy throws, the copies already constructed are destroyed.
+ */
+template <class Allocator, typename InputIt, typename T>
+void construct_copy(Allocator &alloc, InputIt first, InputIt last,
+                    T *destiny) {
+  T *runner{destiny};
+  try {
+    for (; first != last; ++first, ++runner) {
+      std::allocator_traits<Allocator>::construct(alloc, runner, *first);
+    }
+  } catch (...) {
+    detail::destroy(alloc, destiny, runner);
+    throw;
+  }
+}
+/*!
+ * Move constructs the elements in the range [first, last) in the uninitialized
+ * memory starting at "destiny". Elements whose move constructor may throw are
+ * copied instead, so if a copy throws the source range is left untouched and
+ * the elements already constructed are destroyed.
+ */
+template <class Allocator, typename T>
+void construct_move(Allocator &alloc, T *first, T *last, T *destiny) {
+  T *runner{destiny};
+  try {
+    for (; first != last; ++first, ++runner) {
+      std::allocator_traits<Allocator>::construct(
+          alloc, runner, std::move_if_noexcept(*first));
+    }
+  } catch (...) {
+    detail::destroy(alloc, destiny, runner);
+    throw;
+  }
+}
+/*!
+ * Moves the elements in the range [first, last) to the uninitialized memory
+ * starting at "destiny", ending the lifetime of the source elements.
+ * Trivially copyable types are copied bitwise. If an element throws, see
+ * construct_move(), the source range is left untouched.
+ * \param alloc allocator to construct and destroy the elements with.
+ * \param first beginning of the range.
+ * \param last end of the range (not included).
+ * \param destiny beginning of the uninitialized destiny memory, must not
+ *        overlap with the source range.
+ */
+template <class Allocator, typename T>
+void relocate(Allocator &alloc, T *first, T *last, T *destiny) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (first != last) {
+      std::memcpy(static_cast<void *>(destiny), first,
+                  (last - first) * sizeof(T));
+    }
+  } else {
+    detail::construct_move(alloc, first, last, destiny);
+    detail::destroy(alloc, first, last);
+  }
+}
+/*!
+ * Opens a gap of "count" uninitialized slots at index "pos_index" of "array",
+ * shifting the following elements to the right. The capacity must already fit
+ * them. The gap must be filled, or closed with drop_gap(), right after.
+ * Trivially copyable types are shifted with a single memmove, the others are
+ * move constructed into the uninitialized end and move assigned in the middle.
+ * \param alloc allocator to construct and destroy the elements with.
+ * \param array beginning of the buffer.
+ * \param size number of elements in the buffer, not counting the gap.
+ * \param pos_index index of the first slot of the gap.
+ * \param count number of slots in the gap.
+ */
+template <class Allocator, typename T>
+void open_gap(Allocator &alloc, T *array, size_t size, size_t pos_index,
+              size_t count) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (pos_index < size) {
+      std::memmove(static_cast<void *>(array + pos_index + count),
+                   array + pos_index, (size - pos_index) * sizeof(T));
+    }
+  } else if (size - pos_index <= count) {
+    // Every element shifted lands in uninitialized memory.
+    detail::relocate(alloc, array + pos_index, array + size,
+                     array + pos_index + count);
+  } else {
+    T *old_end = array + size;
+    detail::construct_move(alloc, old_end - count, old_end, old_end);
+    std::move_backward(array + pos_index, old_end - count, old_end);
+    detail::destroy(alloc, array + pos_index, array + pos_index + count);
+  }
+}
+/*!
+ * Closes a gap of "count" uninitialized slots opened by open_gap(), shifting
+ * the following elements back to the left.
+ * \param alloc allocator to construct and destroy the elements with.
+ * \param array beginning of the buffer.
+ * \param size number of elements in the buffer, not counting the gap.
+ * \param pos_index index of the first slot of the gap.
+ * \param count number of slots in the gap.
+ */
+template <class Allocator, typename T>
+void drop_gap(Allocator &alloc, T *array, size_t size, size_t pos_index,
+              size_t count) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (pos_index < size) {
+      std::memmove(static_cast<void *>(array + pos_index),
+                   array + pos_index + count, (size - pos_index) * sizeof(T));
+    }
+  } else {
+    // The first elements land in the gap, the others in slots already moved.
+    size_t tail = size - pos_index;
+    size_t constructed = std::min(tail, count);
+    T *gap = array + pos_index;
+    for (size_t index{0}; index < constructed; ++index) {
+      std::allocator_traits<Allocator>::construct(
+          alloc, gap + index, std::move(gap[count + index]));
+    }
+    std::move(gap + count + constructed, gap + count + tail, gap + constructed);
+    detail::destroy(alloc, gap + std::max(tail, count), gap + count + tail);
+  }
+}
+/*!
+ * Inserts "count" elements at index "pos_index" of "array": opens a gap for
+ * them with open_gap() and fills it with "construct". The capacity must
+ * already fit them. "size" is only increased once all of them are constructed,
+ * if "construct" throws the gap is closed again and the exception propagated.
+ * \param alloc allocator to construct and destroy the elements with.
+ * \param array beginning of the buffer.
+ * \param size number of elements in the buffer, increased by "count".
+ * \param pos_index index of the first element to insert.
+ * \param count number of elements to insert.
+ * \param construct function that receives a pointer to the gap and constructs
+ *        the "count" elements in it. If it throws, it must not leave any of
+ *        them constructed.
+ */
+template <class Allocator, typename T, typename Construct>
+void insert_gap(Allocator &alloc, T *array, size_t &size, size_t pos_index,
+                size_t count, Construct construct) {
+  detail::open_gap(alloc, array, size, pos_index, count);
+  try {
+    construct(array + pos_index);
+  } catch (...) {
+    detail::drop_gap(alloc, array, size, pos_index, count);
+    throw;
+  }
+  size += count;
+}
+/*!
+ * Destroys the "count" elements starting at index "pos_index" of "array",
+ * shifting the following elements to the left to close the gap. Trivially
+ * copyable types are shifted with a single memmove, the others are move
+ * assigned.
+ * \param alloc allocator to destroy the elements with.
+ * \param array beginning of the buffer.
+ * \param size number of elements in the buffer, decreased by "count".
+ * \param pos_index index of the first element to remove.
+ * \param count number of elements to remove.
+ */
+template <class Allocator, typename T>
+void close_gap(Allocator &alloc, T *array, size_t &size, size_t pos_index,
+               size_t count) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (pos_index + count < size) {
+      std::memmove(static_cast<void *>(array + pos_index),
+                   array + pos_index + count,
+                   (size - pos_index - count) * sizeof(T));
+    }
+  } else {
+    std::move(array + pos_index + count, array + size, array + pos_index);
+    detail::destroy(alloc, array + size - count, array + size);
+  }
+  size -= count;
+}
+} // namespace detail
+} // namespace sc
+
+#endif // SRC_INCLUDE_VECTOR_ARRAYOPERATIONS_H_
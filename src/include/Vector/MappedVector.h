@@ -0,0 +1,351 @@
+#ifndef SRC_INCLUDE_VECTOR_MAPPEDVECTOR_H_
+#define SRC_INCLUDE_VECTOR_MAPPEDVECTOR_H_
+
+#include "Vector.h"
+#include <cerrno>       // errno
+#include <cstddef>      // size_t, ptrdiff_t
+#include <cstdint>      // uint64_t
+#include <fcntl.h>      // open
+#include <new>          // placement new
+#include <stdexcept>    // runtime_error, logic_error
+#include <string>       // string
+#include <sys/mman.h>   // mmap, munmap, msync
+#include <sys/stat.h>   // fstat
+#include <system_error> // system_error, generic_category
+#include <type_traits>  // is_trivially_copyable
+#include <unistd.h>     // close, ftruncate, sysconf
+#include <utility>      // exchange, forward
+
+// Namespace for sequential containers(sc).
+namespace sc {
+/*!
+ * Vector whose buffer is a memory mapped file, so the elements persist between
+ * processes. Opening an existing file maps it back without reading nor copying
+ * anything, the pages are loaded on demand when the elements are accessed.
+ * Only trivially copyable types can be stored, because the elements are saved
+ * as their raw bytes. The file is not portable between machines with different
+ * data representation. POSIX only.
+ *
+ * The file starts with a header, which keeps the number of elements, followed
+ * by the elements. Its size is the capacity of the vector.
+ * \tparam T data type to store.
+ * \tparam GrowthPolicy functor that decides the new capacity when an insertion
+ *         does not fit, see namespace growth. Default = growth::Double.
+ *
+ * \author Eduardo Marinho (eduardo.nestor.marinho228@gmail.com)
+ */
+template <typename T, class GrowthPolicy = growth::Double<T>>
+class mapped_vector {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "mapped_vector can only store trivially copyable types");
+
+  /// Beginning of the file, padded so the elements start aligned.
+  struct alignas(64) Header {
+    uint64_t magic;        //!< Identifies the file as a mapped_vector.
+    uint64_t element_size; //!< sizeof(T) of the vector that created the file.
+    uint64_t size;         //!< Number of elements in the container.
+  };
+  static_assert(alignof(T) <= alignof(Header),
+                "mapped_vector does not support over-aligned types");
+
+public:
+  //=== Aliases.
+  using value_type = T;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+  /// How the file is opened.
+  enum class mode {
+    read_write, //!< Creates the file if needed, and allows modifications.
+    read_only   //!< The file must exist. The container must not be modified.
+  };
+
+  //=== [I] Special Functions
+  /*!
+   * Maps the file at "path", creating an empty vector in it if it does not
+   * exist, or if it is empty, in read_write mode.
+   * \param path path of the file.
+   * \param open_mode whether the vector can be modified. A read_only vector
+   *        must only be accessed through const references.
+   * \throw std::system_error if the file cannot be opened or mapped.
+   * \throw std::runtime_error if the file does not hold a mapped_vector of T.
+   */
+  explicit mapped_vector(const std::string &path,
+                         mode open_mode = mode::read_write)
+      : m_read_only{open_mode == mode::read_only} {
+    m_file = ::open(path.c_str(), m_read_only ? O_RDONLY : O_RDWR | O_CREAT,
+                    0644);
+    if (m_file < 0) {
+      throw std::system_error(errno, std::generic_category(), path);
+    }
+    try {
+      open_mapping(path);
+    } catch (...) {
+      close();
+      throw;
+    }
+  }
+  /// The file can only be mapped by one vector at a time.
+  mapped_vector(const mapped_vector &) = delete;
+  /// Takes over the mapping of "other", which is left closed.
+  mapped_vector(mapped_vector &&other) noexcept
+      : m_file{std::exchange(other.m_file, -1)},
+        m_header{std::exchange(other.m_header, nullptr)},
+        m_bytes{std::exchange(other.m_bytes, 0)},
+        m_capacity{std::exchange(other.m_capacity, 0)},
+        m_read_only{other.m_read_only} {}
+  /// The file can only be mapped by one vector at a time.
+  mapped_vector &operator=(const mapped_vector &) = delete;
+  /// Closes this vector and takes over the mapping of "other".
+  mapped_vector &operator=(mapped_vector &&other) noexcept {
+    if (this != &other) {
+      close();
+      m_file = std::exchange(other.m_file, -1);
+      m_header = std::exchange(other.m_header, nullptr);
+      m_bytes = std::exchange(other.m_bytes, 0);
+      m_capacity = std::exchange(other.m_capacity, 0);
+      m_read_only = other.m_read_only;
+    }
+    return *this;
+  }
+  /// Unmaps and closes the file. The elements stay in it.
+  ~mapped_vector() { close(); }
+
+  //=== [II] Element Access
+  /// Access the element in the front of the container.
+  reference front() { return data()[0]; }
+  /// Access the element in the front of the container.
+  const_reference front() const { return data()[0]; }
+  /// Access the element in the end of the container.
+  reference back() { return data()[size() - 1]; }
+  /// Access the element in the end of the container.
+  const_reference back() const { return data()[size() - 1]; }
+  /// Consults the pointer to the mapped elements.
+  pointer data() { return reinterpret_cast<pointer>(m_header + 1); }
+  /// Consults the pointer to the mapped elements.
+  const_pointer data() const {
+    return reinterpret_cast<const_pointer>(m_header + 1);
+  }
+  /// Access the element at the "pos" position in the container.
+  reference at(size_type pos) { return data()[pos]; }
+  /// Access the element at the "pos" position in the container.
+  const_reference at(size_type pos) const { return data()[pos]; }
+  /// Access the element at the "pos" position in the container.
+  reference operator[](size_type pos) { return at(pos); }
+  /// Access the element at the "pos" position in the container.
+  const_reference operator[](size_type pos) const { return at(pos); }
+
+  //=== [III] Iterators
+  /// Gets a iterator to the beginning of the container.
+  iterator begin() { return data(); }
+  /// Gets a const_iterator to the beginning of the container.
+  const_iterator begin() const { return data(); }
+  /// Gets a const_iterator to the beginning of the container.
+  const_iterator cbegin() const { return data(); }
+  /// Gets a iterator to the element past the last element.
+  iterator end() { return data() + size(); }
+  /// Gets a const_iterator to the element past the last element.
+  const_iterator end() const { return data() + size(); }
+  /// Gets a const_iterator to the element past the last element.
+  const_iterator cend() const { return data() + size(); }
+
+  //=== [IV] Capacity
+  /// Consults whether the container is empty.
+  bool empty() const { return size() == 0; }
+  /// Consults the number of elements in the container.
+  size_type size() const { return m_header->size; }
+  /// Consults the number of elements the file can hold without growing.
+  size_type capacity() const { return m_capacity; }
+  /// Consults whether the file was opened in read_only mode.
+  bool read_only() const { return m_read_only; }
+  /*!
+   * If new_capacity is greater than the current capacity of the container, the
+   * file is enlarged and mapped again, otherwise the function does nothing.
+   * \param new_capacity capacity that the container should have.
+   * \throw std::logic_error if the file was opened in read_only mode.
+   */
+  void reserve(size_type new_capacity) {
+    if (new_capacity > m_capacity) {
+      remap(new_capacity);
+    }
+  }
+  /*!
+   * Shrinks the file to the smallest number of pages that holds the elements.
+   * \throw std::logic_error if the file was opened in read_only mode.
+   */
+  void shrink_to_fit() { remap(size()); }
+
+  //=== [V] Modifiers
+  /// Removes all elements of the container, i.e. empties it.
+  void clear() { m_header->size = 0; }
+  /*!
+   * Constructs an element in the end of the container.
+   * \param args arguments to forward to the constructor of the element.
+   * \return reference to the inserted element.
+   */
+  template <typename... Args> reference emplace_back(Args &&...args) {
+    if (size() == m_capacity) {
+      // The arguments may refer to elements, which the new mapping moves, so
+      // the element is built before the file is mapped again.
+      value_type element(std::forward<Args>(args)...);
+      remap(GrowthPolicy{}(m_capacity, size() + 1));
+      ::new (data() + size()) value_type(element);
+    } else {
+      ::new (data() + size()) value_type(std::forward<Args>(args)...);
+    }
+    return data()[m_header->size++];
+  }
+  /*!
+   * Inserts a element in the end of the container.
+   * \param value data to store.
+   */
+  void push_back(const_reference value) { emplace_back(value); }
+  /// Removes the element in the end of the container.
+  void pop_back() { --m_header->size; }
+  /*!
+   * Changes the size of the container, inserting copies of "value" or removing
+   * elements from the end.
+   * \param new_size new size of the container.
+   * \param value data to store in case on need. If not provided, default
+   *        constructor will be used.
+   */
+  void resize(size_type new_size, const_reference value = value_type()) {
+    // "value" may be an element, which the new mapping moves, so it is copied.
+    const value_type copy(value);
+    reserve(new_size);
+    for (size_type index{size()}; index < new_size; ++index) {
+      ::new (data() + index) value_type(copy);
+    }
+    m_header->size = new_size;
+  }
+  /*!
+   * Writes the modified pages to the file and waits for it. Without it, the
+   * operating system still writes them eventually, even if the process
+   * crashes, but not if the machine does.
+   * \throw std::system_error if the pages cannot be written.
+   */
+  void flush() {
+    if (::msync(m_header, m_bytes, MS_SYNC) < 0) {
+      throw std::system_error(errno, std::generic_category(), "msync");
+    }
+  }
+
+private:
+  //=== Auxiliary Functions.
+  /*!
+   * Maps the opened file, writing a header to it if it is empty, or checking
+   * its header otherwise.
+   * \param path path of the file, for error messages.
+   */
+  void open_mapping(const std::string &path) {
+    struct stat status;
+    if (::fstat(m_file, &status) < 0) {
+      throw std::system_error(errno, std::generic_category(), path);
+    }
+    auto bytes = static_cast<size_type>(status.st_size);
+    if (bytes == 0 && !m_read_only) {
+      bytes = round_to_pages(sizeof(Header));
+      resize_file(bytes);
+      map(bytes);
+      m_header->magic = MAGIC;
+      m_header->element_size = sizeof(value_type);
+      m_header->size = 0;
+      return;
+    }
+    if (bytes < sizeof(Header)) {
+      throw std::runtime_error(path + " is not a mapped_vector");
+    }
+    map(bytes);
+    if (m_header->magic != MAGIC ||
+        m_header->element_size != sizeof(value_type)) {
+      throw std::runtime_error(path + " is not a mapped_vector of this type");
+    }
+    if (m_header->size > m_capacity) {
+      throw std::runtime_error(path + " holds more elements than fit in it");
+    }
+  }
+  /// Rounds "bytes" up to a whole number of pages.
+  static size_type round_to_pages(size_type bytes) {
+    const auto page_size = static_cast<size_type>(::sysconf(_SC_PAGESIZE));
+    return (bytes + page_size - 1) / page_size * page_size;
+  }
+  /// Changes the size of the file to "bytes".
+  void resize_file(size_type bytes) {
+    if (::ftruncate(m_file, static_cast<off_t>(bytes)) < 0) {
+      throw std::system_error(errno, std::generic_category(), "ftruncate");
+    }
+  }
+  /// Maps the first "bytes" bytes of the file.
+  void map(size_type bytes) {
+    void *address =
+        ::mmap(nullptr, bytes, m_read_only ? PROT_READ : PROT_READ | PROT_WRITE,
+               MAP_SHARED, m_file, 0);
+    if (address == MAP_FAILED) {
+      throw std::system_error(errno, std::generic_category(), "mmap");
+    }
+    m_header = static_cast<Header *>(address);
+    m_bytes = bytes;
+    m_capacity = (bytes - sizeof(Header)) / sizeof(value_type);
+  }
+  /// Unmaps the file.
+  void unmap() {
+    ::munmap(m_header, m_bytes);
+    m_header = nullptr;
+  }
+  /*!
+   * Resizes the file to hold "new_capacity" elements, rounded up to whole
+   * pages, and maps it again. The elements are not copied, they stay in the
+   * file. The old mapping is only removed once the new one exists, so if
+   * growing fails the vector is left as it was, over a bigger file, and when
+   * shrinking the file is only cut once nothing maps the part cut off.
+   * \param new_capacity capacity the container should have, not less than
+   *        the size.
+   */
+  void remap(size_type new_capacity) {
+    if (m_read_only) {
+      throw std::logic_error("mapped_vector opened in read_only mode");
+    }
+    size_type bytes =
+        round_to_pages(sizeof(Header) + new_capacity * sizeof(value_type));
+    if (bytes == m_bytes) {
+      return;
+    }
+    if (bytes > m_bytes) {
+      resize_file(bytes);
+    }
+    Header *old_header = m_header;
+    size_type old_bytes = m_bytes;
+    map(bytes);
+    ::munmap(old_header, old_bytes);
+    if (bytes < old_bytes) {
+      resize_file(bytes);
+    }
+  }
+  /// Unmaps and closes the file, if this vector has one.
+  void close() {
+    if (m_header != nullptr) {
+      unmap();
+    }
+    if (m_file >= 0) {
+      ::close(m_file);
+      m_file = -1;
+    }
+  }
+
+  /// Identifies the files created by mapped_vector, "scvector" in ASCII.
+  static constexpr uint64_t MAGIC = 0x73637665'63746f72;
+
+  int m_file{-1};            //!< File descriptor of the file.
+  Header *m_header{nullptr}; //!< Beginning of the mapping, the header.
+  size_type m_bytes{0};      //!< Size of the mapping, i.e. of the file.
+  size_type m_capacity{0};   //!< Number of elements the file can hold.
+  bool m_read_only{false};   //!< Whether the file was opened read only.
+};
+} // namespace sc
+
+#endif // SRC_INCLUDE_VECTOR_MAPPEDVECTOR_H_
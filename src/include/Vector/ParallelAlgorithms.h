@@ -0,0 +1,434 @@
+#ifndef SRC_INCLUDE_VECTOR_PARALLELALGORITHMS_H_
+#define SRC_INCLUDE_VECTOR_PARALLELALGORITHMS_H_
+
+#include "Vector.h"
+#include <algorithm>          // clamp, fill, merge, min, sort, transform
+#include <atomic>             // atomic
+#include <condition_variable> // condition_variable
+#include <cstddef>            // size_t
+#include <cstdint>            // uint64_t
+#include <exception>          // exception_ptr, current_exception
+#include <functional>         // less
+#include <iterator>           // iterator_traits, make_move_iterator
+#include <memory>             // allocator, uninitialized_copy, destroy
+#include <mutex>              // mutex, lock_guard, unique_lock
+#include <thread>             // thread, hardware_concurrency
+#include <type_traits>        // remove_reference_t
+#include <utility>            // exchange, move
+
+// Namespace for sequential containers(sc).
+namespace sc {
+/*!
+ * Bulk operations split among the threads of a thread_pool: construction of
+ * sc::vector from a range, fill, transform and sort. The number of threads is
+ * the one the pool was created with, so the same code can be run with any of
+ * them. Ranges too small to be worth splitting are processed by the calling
+ * thread alone.
+ */
+namespace parallel {
+/*!
+ * Fixed set of threads that run the tasks of a job together. The thread that
+ * calls run() takes part in the job too, so a pool of N threads starts N - 1.
+ *
+ * \author Eduardo Marinho (eduardo.nestor.marinho228@gmail.com)
+ */
+class thread_pool {
+public:
+  /*!
+   * Starts the threads of the pool.
+   * \param threads number of threads that run a job, including the caller.
+   *        Default = the number of hardware threads.
+   */
+  explicit thread_pool(size_t threads = std::thread::hardware_concurrency()) {
+    for (size_t counter{1}; counter < threads; ++counter) {
+      m_workers.emplace_back([this] { work(); });
+    }
+  }
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+  /// Waits for the threads to finish and joins them.
+  ~thread_pool() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_wake.notify_all();
+    for (auto &worker : m_workers) {
+      worker.join();
+    }
+  }
+
+  /// Consults the number of threads that run a job, including the caller.
+  size_t size() const { return m_workers.size() + 1; }
+  /*!
+   * Calls "task" once for each index in [0, tasks), from any of the threads,
+   * and waits until all of them return. Jobs of different callers run one at
+   * a time, and a task must not call run() on the same pool.
+   * \param tasks number of calls to make.
+   * \param task function that receives the index of the call.
+   * \throw the first exception thrown by a task, the remaining tasks are
+   *        skipped then.
+   */
+  template <typename Task> void run(size_t tasks, Task &&task) {
+    if (tasks <= 1 || m_workers.empty()) {
+      for (size_t index{0}; index < tasks; ++index) {
+        task(index);
+      }
+      return;
+    }
+    std::lock_guard<std::mutex> job(m_job);
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_invoke = [](void *context, size_t index) {
+        (*static_cast<std::remove_reference_t<Task> *>(context))(index);
+      };
+      m_context = &task;
+      m_tasks = tasks;
+      m_next.store(0, std::memory_order_relaxed);
+      m_busy = m_workers.size();
+      ++m_generation;
+    }
+    m_wake.notify_all();
+    drain();
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return m_busy == 0; });
+    if (m_error) {
+      std::rethrow_exception(std::exchange(m_error, nullptr));
+    }
+  }
+
+private:
+  //=== Auxiliary Functions.
+  /// Loop of the worker threads, which join every job until the pool dies.
+  void work() {
+    uint64_t seen{0};
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+      m_wake.wait(lock, [&] { return m_stop || m_generation != seen; });
+      if (m_stop) {
+        return;
+      }
+      seen = m_generation;
+      lock.unlock();
+      drain();
+      lock.lock();
+      if (--m_busy == 0) {
+        m_done.notify_one();
+      }
+    }
+  }
+  /// Runs tasks of the current job until there are none left.
+  void drain() {
+    size_t index;
+    while ((index = m_next.fetch_add(1, std::memory_order_relaxed)) <
+           m_tasks) {
+      try {
+        m_invoke(m_context, index);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_error) {
+          m_error = std::current_exception();
+        }
+        m_next.store(m_tasks, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  vector<std::thread> m_workers;             //!< Threads started by the pool.
+  std::mutex m_job;                          //!< Runs one job at a time.
+  std::mutex m_mutex;                        //!< Guards the job state.
+  std::condition_variable m_wake;            //!< Signals a new job or the stop.
+  std::condition_variable m_done;            //!< Signals the workers are idle.
+  void (*m_invoke)(void *, size_t){nullptr}; //!< Calls the task of the job.
+  void *m_context{nullptr};                  //!< Task of the job.
+  size_t m_tasks{0};                         //!< Number of tasks of the job.
+  std::atomic<size_t> m_next{0};             //!< Index of the next task to run.
+  size_t m_busy{0};                          //!< Workers still running the job.
+  uint64_t m_generation{0};                  //!< Number of jobs started.
+  bool m_stop{false};                        //!< Whether the pool is dying.
+  std::exception_ptr m_error;                //!< First exception of a task.
+};
+
+namespace detail {
+/// Fewest elements worth handing to a thread.
+constexpr size_t GRAIN{size_t{1} << 14};
+
+/// Number of slices to split "size" elements among the threads of "pool".
+inline size_t slice_count(const thread_pool &pool, size_t size) {
+  return std::clamp<size_t>(size / GRAIN, 1, pool.size());
+}
+
+/// Beginning of the slice "index" when splitting "size" in "count" slices.
+inline size_t slice_begin(size_t size, size_t count, size_t index) {
+  return size / count * index + std::min(index, size % count);
+}
+
+/*!
+ * Calls "function" with the [begin, end) bounds of each of "count" slices of
+ * "size" elements, in parallel.
+ */
+template <typename Function>
+void for_each_slice(thread_pool &pool, size_t size, size_t count,
+                    Function &&function) {
+  pool.run(count, [&](size_t index) {
+    function(slice_begin(size, count, index),
+             slice_begin(size, count, index + 1));
+  });
+}
+
+/*!
+ * Constructs "size" elements in the uninitialized "storage", in parallel.
+ * If a slice throws, the ones already constructed are destroyed, so none is
+ * left constructed.
+ * \param construct function that constructs the [begin, end) elements of
+ *        "storage", leaving none of them constructed if it throws.
+ */
+template <typename T, typename Construct>
+void construct_slices(thread_pool &pool, T *storage, size_t size,
+                      Construct &&construct) {
+  size_t count{slice_count(pool, size)};
+  vector<unsigned char> built(count, 0);
+  try {
+    pool.run(count, [&](size_t index) {
+      construct(slice_begin(size, count, index),
+                slice_begin(size, count, index + 1));
+      built[index] = 1;
+    });
+  } catch (...) {
+    for (size_t index{0}; index < count; ++index) {
+      if (built[index] != 0) {
+        std::destroy(storage + slice_begin(size, count, index),
+                     storage + slice_begin(size, count, index + 1));
+      }
+    }
+    throw;
+  }
+}
+
+/*!
+ * Finds how many of the first "diagonal" elements of the stable merge of the
+ * sorted ranges "lhs" and "rhs" come from "lhs", by binary search, so a merge
+ * can be split in independent pieces.
+ */
+template <typename RandomIt, typename Compare>
+size_t co_rank(RandomIt lhs, size_t lhs_size, RandomIt rhs, size_t rhs_size,
+               size_t diagonal, Compare &comp) {
+  size_t low{diagonal > rhs_size ? diagonal - rhs_size : 0};
+  size_t high{std::min(diagonal, lhs_size)};
+  while (low < high) {
+    size_t taken{low + (high - low) / 2};
+    // Ties are taken from "lhs" first, keeping the merge stable.
+    if (!comp(rhs[diagonal - taken - 1], lhs[taken])) {
+      low = taken + 1;
+    } else {
+      high = taken;
+    }
+  }
+  return low;
+}
+
+/*!
+ * Merges each pair of consecutive sorted runs of "source" into the same
+ * positions of "destination", moving the elements. The merge of each pair is
+ * split in pieces so every thread has work until the last round. The bounds
+ * of all the pieces are found before any element is moved, since the binary
+ * searches of a piece read elements that other pieces move.
+ * \param runs bounds of the runs, the first one at 0 and the last at the end.
+ */
+template <typename Source, typename Destination, typename Compare>
+void merge_round(thread_pool &pool, Source source, Destination destination,
+                 const vector<size_t> &runs, Compare &comp) {
+  size_t pairs{(runs.size() - 1) / 2};
+  size_t pieces{std::max<size_t>(1, pool.size() / pairs)};
+  bool leftover{(runs.size() - 1) % 2 != 0};
+  // Elements of the left run before the bounds of each piece, pieces + 1
+  // bounds per pair.
+  vector<size_t> splits(pairs * (pieces + 1), 0);
+  pool.run(splits.size(), [&](size_t task) {
+    size_t pair{task / (pieces + 1)};
+    size_t begin{runs[2 * pair]};
+    size_t middle{runs[2 * pair + 1]};
+    size_t end{runs[2 * pair + 2]};
+    size_t diagonal{slice_begin(end - begin, pieces, task % (pieces + 1))};
+    splits[task] = co_rank(source + begin, middle - begin, source + middle,
+                           end - middle, diagonal, comp);
+  });
+  pool.run(pairs * pieces + leftover, [&](size_t task) {
+    size_t pair{task / pieces};
+    if (pair == pairs) {
+      size_t begin{runs[runs.size() - 2]};
+      std::move(source + begin, source + runs.back(), destination + begin);
+      return;
+    }
+    size_t begin{runs[2 * pair]};
+    size_t middle{runs[2 * pair + 1]};
+    size_t end{runs[2 * pair + 2]};
+    size_t piece{task % pieces};
+    size_t out_begin{slice_begin(end - begin, pieces, piece)};
+    size_t out_end{slice_begin(end - begin, pieces, piece + 1)};
+    size_t lhs_begin{splits[pair * (pieces + 1) + piece]};
+    size_t lhs_end{splits[pair * (pieces + 1) + piece + 1]};
+    Source lhs{source + begin};
+    Source rhs{source + middle};
+    std::merge(std::make_move_iterator(lhs + lhs_begin),
+               std::make_move_iterator(lhs + lhs_end),
+               std::make_move_iterator(rhs + (out_begin - lhs_begin)),
+               std::make_move_iterator(rhs + (out_end - lhs_end)),
+               destination + begin + out_begin, comp);
+  });
+}
+} // namespace detail
+
+/*!
+ * Assigns "value" to every element of [first, last).
+ * \param pool threads to split the work among.
+ */
+template <typename RandomIt, typename T>
+void fill(thread_pool &pool, RandomIt first, RandomIt last, const T &value) {
+  size_t size = last - first;
+  detail::for_each_slice(pool, size, detail::slice_count(pool, size),
+                         [&](size_t begin, size_t end) {
+                           std::fill(first + begin, first + end, value);
+                         });
+}
+
+/*!
+ * Stores the result of "operation" for each element of [first, last) in the
+ * range starting at "out".
+ * \param pool threads to split the work among.
+ * \return iterator past the last element stored.
+ */
+template <typename RandomIt, typename OutputIt, typename Operation>
+OutputIt transform(thread_pool &pool, RandomIt first, RandomIt last,
+                   OutputIt out, Operation operation) {
+  size_t size = last - first;
+  detail::for_each_slice(pool, size, detail::slice_count(pool, size),
+                         [&](size_t begin, size_t end) {
+                           std::transform(first + begin, first + end,
+                                          out + begin, operation);
+                         });
+  return out + size;
+}
+
+/*!
+ * Inserts copies of the elements of [first, last) in the end of "list",
+ * constructing them in parallel. The pages of the new elements are touched
+ * first by the thread that constructs them, too.
+ * \param pool threads to split the work among.
+ */
+template <typename T, class G, class A, typename RandomIt>
+void append(thread_pool &pool, vector<T, G, A> &list, RandomIt first,
+            RandomIt last) {
+  size_t size = last - first;
+  list.append_uninitialized(size, [&](T *storage) {
+    detail::construct_slices(pool, storage, size, [&](size_t begin,
+                                                      size_t end) {
+      std::uninitialized_copy(first + begin, first + end, storage + begin);
+    });
+  });
+}
+
+/*!
+ * Replaces the contents of "list" by copies of the elements of
+ * [first, last), constructing them in parallel.
+ * \param pool threads to split the work among.
+ */
+template <typename T, class G, class A, typename RandomIt>
+void assign(thread_pool &pool, vector<T, G, A> &list, RandomIt first,
+            RandomIt last) {
+  list.clear();
+  append(pool, list, first, last);
+}
+
+/*!
+ * Replaces the contents of "list" by "count" copies of "value", constructing
+ * them in parallel.
+ * \param pool threads to split the work among.
+ */
+template <typename T, class G, class A>
+void assign(thread_pool &pool, vector<T, G, A> &list, size_t count,
+            const T &value) {
+  list.clear();
+  list.append_uninitialized(count, [&](T *storage) {
+    detail::construct_slices(pool, storage, count, [&](size_t begin,
+                                                       size_t end) {
+      std::uninitialized_fill(storage + begin, storage + end, value);
+    });
+  });
+}
+
+/*!
+ * Sorts [first, last) in the order given by "comp". Each thread sorts a slice
+ * of the range, then the sorted slices are merged in pairs, each merge split
+ * among the threads, until a single one is left. Uses a buffer as large as the
+ * range. Like std::sort, the order of equal elements is not preserved.
+ * \param pool threads to split the work among.
+ * \param comp function that returns whether the first argument goes before
+ *        the second one. Default = std::less.
+ */
+template <typename RandomIt, typename Compare = std::less<>>
+void sort(thread_pool &pool, RandomIt first, RandomIt last,
+          Compare comp = Compare()) {
+  using value_type = typename std::iterator_traits<RandomIt>::value_type;
+  size_t size = last - first;
+  size_t count{detail::slice_count(pool, size)};
+  detail::for_each_slice(pool, size, count, [&](size_t begin, size_t end) {
+    std::sort(first + begin, first + end, comp);
+  });
+  if (count == 1) {
+    return;
+  }
+
+  std::allocator<value_type> allocator;
+  value_type *buffer = allocator.allocate(size);
+  try {
+    detail::construct_slices(pool, buffer, size, [&](size_t begin,
+                                                     size_t end) {
+      std::uninitialized_move(first + begin, first + end, buffer + begin);
+    });
+  } catch (...) {
+    allocator.deallocate(buffer, size);
+    throw;
+  }
+  vector<size_t> runs;
+  for (size_t index{0}; index <= count; ++index) {
+    runs.push_back(detail::slice_begin(size, count, index));
+  }
+  bool in_buffer{true};
+  try {
+    while (runs.size() > 2) {
+      if (in_buffer) {
+        detail::merge_round(pool, buffer, first, runs, comp);
+      } else {
+        detail::merge_round(pool, first, buffer, runs, comp);
+      }
+      in_buffer = !in_buffer;
+      vector<size_t> merged;
+      for (size_t index{0}; index < runs.size(); index += 2) {
+        merged.push_back(runs[index]);
+      }
+      if (runs.size() % 2 == 0) {
+        merged.push_back(runs.back());
+      }
+      runs = std::move(merged);
+    }
+    if (in_buffer) {
+      detail::for_each_slice(pool, size, count, [&](size_t begin,
+                                                    size_t end) {
+        std::move(buffer + begin, buffer + end, first + begin);
+      });
+    }
+  } catch (...) {
+    std::destroy(buffer, buffer + size);
+    allocator.deallocate(buffer, size);
+    throw;
+  }
+  detail::for_each_slice(pool, size, count, [&](size_t begin, size_t end) {
+    std::destroy(buffer + begin, buffer + end);
+  });
+  allocator.deallocate(buffer, size);
+}
+} // namespace parallel
+} // namespace sc
+
+#endif // SRC_INCLUDE_VECTOR_PARALLELALGORITHMS_H_
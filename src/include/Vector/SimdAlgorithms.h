@@ -0,0 +1,642 @@
+#ifndef SRC_INCLUDE_VECTOR_SIMDALGORITHMS_H_
+#define SRC_INCLUDE_VECTOR_SIMDALGORITHMS_H_
+
+#include "Span.h"
+#include "Vector.h"
+#include <cstddef>     // size_t
+#include <cstdint>     // int32_t, int64_t, uint64_t
+#include <type_traits> // conditional_t, is_same_v, remove_cv_t
+
+#if defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__))
+#define SC_SIMD_X86
+#include <immintrin.h>
+#endif
+
+// Namespace for sequential containers(sc).
+namespace sc {
+/*!
+ * Vectorized versions of find, count, min, max and sum over contiguous ranges:
+ * raw pointers, sc::span and sc::vector. Ranges of int32_t and float are
+ * processed with SSE2 or AVX2, chosen at runtime from what the CPU supports,
+ * so the same binary runs on any x86 machine. Every other type, and every
+ * other architecture, falls back to scalar loops.
+ */
+namespace simd {
+/// Instruction sets the algorithms can be dispatched to.
+enum class isa { scalar, sse2, avx2 };
+
+/// Type of the result of sum(), wide enough to not overflow for integers.
+template <typename T>
+using sum_type =
+    std::conditional_t<std::is_floating_point_v<T>, T,
+                       std::conditional_t<std::is_signed_v<T>, int64_t,
+                                          uint64_t>>;
+
+namespace detail {
+/// Finds the best instruction set supported by the CPU.
+inline isa detect() {
+#ifdef SC_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return isa::avx2;
+  }
+  if (__builtin_cpu_supports("sse2")) {
+    return isa::sse2;
+  }
+#endif
+  return isa::scalar;
+}
+
+/// Instruction set used by the algorithms, detected on the first call.
+inline isa &active() {
+  static isa selected{detect()};
+  return selected;
+}
+
+/// Whether there are vectorized kernels for ranges of T.
+template <typename T>
+constexpr bool vectorized_v =
+    std::is_same_v<T, int32_t> || std::is_same_v<T, float>;
+
+//=== Scalar kernels, also used for the elements that do not fill a register.
+template <typename T>
+const T *find_scalar(const T *first, const T *last, const T &value) {
+  for (; first != last; ++first) {
+    if (*first == value) {
+      return first;
+    }
+  }
+  return last;
+}
+
+template <typename T>
+size_t count_scalar(const T *first, const T *last, const T &value) {
+  size_t result{0};
+  for (; first != last; ++first) {
+    result += *first == value;
+  }
+  return result;
+}
+
+template <typename T> T min_scalar(const T *first, const T *last, T result) {
+  for (; first != last; ++first) {
+    result = *first < result ? *first : result;
+  }
+  return result;
+}
+
+template <typename T> T max_scalar(const T *first, const T *last, T result) {
+  for (; first != last; ++first) {
+    result = result < *first ? *first : result;
+  }
+  return result;
+}
+
+template <typename T>
+sum_type<T> sum_scalar(const T *first, const T *last, sum_type<T> result) {
+  for (; first != last; ++first) {
+    result += *first;
+  }
+  return result;
+}
+
+#ifdef SC_SIMD_X86
+/// Count lanes are flushed after this many iterations, before they overflow.
+constexpr size_t COUNT_FLUSH{size_t{1} << 20};
+
+//=== SSE2 kernels, 4 elements per register.
+inline __m128i load(const int32_t *first) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+}
+
+/// Adds up the lanes of a register of counters.
+inline size_t reduce_count(__m128i counters) {
+  alignas(16) uint32_t lanes[4];
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes), counters);
+  return size_t{lanes[0]} + lanes[1] + lanes[2] + lanes[3];
+}
+
+/// Lane-wise minimum, SSE2 has no _mm_min_epi32.
+inline __m128i min_epi32(__m128i lhs, __m128i rhs) {
+  __m128i greater = _mm_cmpgt_epi32(lhs, rhs);
+  return _mm_or_si128(_mm_and_si128(greater, rhs),
+                      _mm_andnot_si128(greater, lhs));
+}
+
+/// Lane-wise maximum, SSE2 has no _mm_max_epi32.
+inline __m128i max_epi32(__m128i lhs, __m128i rhs) {
+  __m128i greater = _mm_cmpgt_epi32(lhs, rhs);
+  return _mm_or_si128(_mm_and_si128(greater, lhs),
+                      _mm_andnot_si128(greater, rhs));
+}
+
+inline const int32_t *find_sse2(const int32_t *first, const int32_t *last,
+                                const int32_t &value) {
+  const __m128i needle = _mm_set1_epi32(value);
+  for (; last - first >= 4; first += 4) {
+    __m128i equal = _mm_cmpeq_epi32(load(first), needle);
+    int mask = _mm_movemask_ps(_mm_castsi128_ps(equal));
+    if (mask != 0) {
+      return first + __builtin_ctz(mask);
+    }
+  }
+  return find_scalar(first, last, value);
+}
+
+inline const float *find_sse2(const float *first, const float *last,
+                              const float &value) {
+  const __m128 needle = _mm_set1_ps(value);
+  for (; last - first >= 4; first += 4) {
+    int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(first), needle));
+    if (mask != 0) {
+      return first + __builtin_ctz(mask);
+    }
+  }
+  return find_scalar(first, last, value);
+}
+
+/// A true comparison is a lane of -1, so subtracting it counts the match.
+inline size_t count_sse2(const int32_t *first, const int32_t *last,
+                         const int32_t &value) {
+  const __m128i needle = _mm_set1_epi32(value);
+  size_t result{0};
+  while (last - first >= 4) {
+    __m128i counters = _mm_setzero_si128();
+    for (size_t step{0}; step < COUNT_FLUSH && last - first >= 4;
+         ++step, first += 4) {
+      counters = _mm_sub_epi32(counters, _mm_cmpeq_epi32(load(first), needle));
+    }
+    result += reduce_count(counters);
+  }
+  return result + count_scalar(first, last, value);
+}
+
+inline size_t count_sse2(const float *first, const float *last,
+                         const float &value) {
+  const __m128 needle = _mm_set1_ps(value);
+  size_t result{0};
+  while (last - first >= 4) {
+    __m128i counters = _mm_setzero_si128();
+    for (size_t step{0}; step < COUNT_FLUSH && last - first >= 4;
+         ++step, first += 4) {
+      __m128 equal = _mm_cmpeq_ps(_mm_loadu_ps(first), needle);
+      counters = _mm_sub_epi32(counters, _mm_castps_si128(equal));
+    }
+    result += reduce_count(counters);
+  }
+  return result + count_scalar(first, last, value);
+}
+
+inline int32_t min_sse2(const int32_t *first, const int32_t *last) {
+  int32_t result{*first};
+  if (last - first >= 4) {
+    __m128i lanes = load(first);
+    for (first += 4; last - first >= 4; first += 4) {
+      lanes = min_epi32(lanes, load(first));
+    }
+    alignas(16) int32_t values[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(values), lanes);
+    result = min_scalar(values, values + 4, values[0]);
+  }
+  return min_scalar(first, last, result);
+}
+
+inline float min_sse2(const float *first, const float *last) {
+  float result{*first};
+  if (last - first >= 4) {
+    __m128 lanes = _mm_loadu_ps(first);
+    for (first += 4; last - first >= 4; first += 4) {
+      lanes = _mm_min_ps(lanes, _mm_loadu_ps(first));
+    }
+    alignas(16) float values[4];
+    _mm_store_ps(values, lanes);
+    result = min_scalar(values, values + 4, values[0]);
+  }
+  return min_scalar(first, last, result);
+}
+
+inline int32_t max_sse2(const int32_t *first, const int32_t *last) {
+  int32_t result{*first};
+  if (last - first >= 4) {
+    __m128i lanes = load(first);
+    for (first += 4; last - first >= 4; first += 4) {
+      lanes = max_epi32(lanes, load(first));
+    }
+    alignas(16) int32_t values[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(values), lanes);
+    result = max_scalar(values, values + 4, values[0]);
+  }
+  return max_scalar(first, last, result);
+}
+
+inline float max_sse2(const float *first, const float *last) {
+  float result{*first};
+  if (last - first >= 4) {
+    __m128 lanes = _mm_loadu_ps(first);
+    for (first += 4; last - first >= 4; first += 4) {
+      lanes = _mm_max_ps(lanes, _mm_loadu_ps(first));
+    }
+    alignas(16) float values[4];
+    _mm_store_ps(values, lanes);
+    result = max_scalar(values, values + 4, values[0]);
+  }
+  return max_scalar(first, last, result);
+}
+
+/// Sign extends each element to 64 bits before adding, so it cannot overflow.
+inline int64_t sum_sse2(const int32_t *first, const int32_t *last) {
+  __m128i low = _mm_setzero_si128();
+  __m128i high = _mm_setzero_si128();
+  for (; last - first >= 4; first += 4) {
+    __m128i block = load(first);
+    __m128i sign = _mm_srai_epi32(block, 31);
+    low = _mm_add_epi64(low, _mm_unpacklo_epi32(block, sign));
+    high = _mm_add_epi64(high, _mm_unpackhi_epi32(block, sign));
+  }
+  alignas(16) int64_t values[2];
+  _mm_store_si128(reinterpret_cast<__m128i *>(values),
+                  _mm_add_epi64(low, high));
+  return sum_scalar(first, last, values[0] + values[1]);
+}
+
+/// Two accumulators hide the latency of the additions.
+inline float sum_sse2(const float *first, const float *last) {
+  __m128 even = _mm_setzero_ps();
+  __m128 odd = _mm_setzero_ps();
+  for (; last - first >= 8; first += 8) {
+    even = _mm_add_ps(even, _mm_loadu_ps(first));
+    odd = _mm_add_ps(odd, _mm_loadu_ps(first + 4));
+  }
+  alignas(16) float values[4];
+  _mm_store_ps(values, _mm_add_ps(even, odd));
+  float result{(values[0] + values[1]) + (values[2] + values[3])};
+  return sum_scalar(first, last, result);
+}
+
+//=== AVX2 kernels, 8 elements per register. Only called when the CPU
+// supports AVX2, the rest of the program does not need to be built with it.
+#define SC_SIMD_AVX2 __attribute__((target("avx2")))
+
+SC_SIMD_AVX2 inline __m256i load256(const int32_t *first) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+}
+
+SC_SIMD_AVX2 inline size_t reduce_count256(__m256i counters) {
+  alignas(32) uint32_t lanes[8];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), counters);
+  size_t result{0};
+  for (uint32_t lane : lanes) {
+    result += lane;
+  }
+  return result;
+}
+
+SC_SIMD_AVX2 inline const int32_t *
+find_avx2(const int32_t *first, const int32_t *last, const int32_t &value) {
+  const __m256i needle = _mm256_set1_epi32(value);
+  for (; last - first >= 8; first += 8) {
+    __m256i equal = _mm256_cmpeq_epi32(load256(first), needle);
+    int mask = _mm256_movemask_ps(_mm256_castsi256_ps(equal));
+    if (mask != 0) {
+      return first + __builtin_ctz(mask);
+    }
+  }
+  return find_sse2(first, last, value);
+}
+
+SC_SIMD_AVX2 inline const float *find_avx2(const float *first,
+                                           const float *last,
+                                           const float &value) {
+  const __m256 needle = _mm256_set1_ps(value);
+  for (; last - first >= 8; first += 8) {
+    __m256 equal = _mm256_cmp_ps(_mm256_loadu_ps(first), needle, _CMP_EQ_OQ);
+    int mask = _mm256_movemask_ps(equal);
+    if (mask != 0) {
+      return first + __builtin_ctz(mask);
+    }
+  }
+  return find_sse2(first, last, value);
+}
+
+SC_SIMD_AVX2 inline size_t count_avx2(const int32_t *first,
+                                      const int32_t *last,
+                                      const int32_t &value) {
+  const __m256i needle = _mm256_set1_epi32(value);
+  size_t result{0};
+  while (last - first >= 8) {
+    __m256i counters = _mm256_setzero_si256();
+    for (size_t step{0}; step < COUNT_FLUSH && last - first >= 8;
+         ++step, first += 8) {
+      __m256i equal = _mm256_cmpeq_epi32(load256(first), needle);
+      counters = _mm256_sub_epi32(counters, equal);
+    }
+    result += reduce_count256(counters);
+  }
+  return result + count_sse2(first, last, value);
+}
+
+SC_SIMD_AVX2 inline size_t count_avx2(const float *first, const float *last,
+                                      const float &value) {
+  const __m256 needle = _mm256_set1_ps(value);
+  size_t result{0};
+  while (last - first >= 8) {
+    __m256i counters = _mm256_setzero_si256();
+    for (size_t step{0}; step < COUNT_FLUSH && last - first >= 8;
+         ++step, first += 8) {
+      __m256 equal =
+          _mm256_cmp_ps(_mm256_loadu_ps(first), needle, _CMP_EQ_OQ);
+      counters = _mm256_sub_epi32(counters, _mm256_castps_si256(equal));
+    }
+    result += reduce_count256(counters);
+  }
+  return result + count_sse2(first, last, value);
+}
+
+SC_SIMD_AVX2 inline int32_t min_avx2(const int32_t *first,
+                                     const int32_t *last) {
+  int32_t result{*first};
+  if (last - first >= 8) {
+    __m256i lanes = load256(first);
+    for (first += 8; last - first >= 8; first += 8) {
+      lanes = _mm256_min_epi32(lanes, load256(first));
+    }
+    alignas(32) int32_t values[8];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(values), lanes);
+    result = min_scalar(values, values + 8, values[0]);
+  }
+  return min_scalar(first, last, result);
+}
+
+SC_SIMD_AVX2 inline float min_avx2(const float *first, const float *last) {
+  float result{*first};
+  if (last - first >= 8) {
+    __m256 lanes = _mm256_loadu_ps(first);
+    for (first += 8; last - first >= 8; first += 8) {
+      lanes = _mm256_min_ps(lanes, _mm256_loadu_ps(first));
+    }
+    alignas(32) float values[8];
+    _mm256_store_ps(values, lanes);
+    result = min_scalar(values, values + 8, values[0]);
+  }
+  return min_scalar(first, last, result);
+}
+
+SC_SIMD_AVX2 inline int32_t max_avx2(const int32_t *first,
+                                     const int32_t *last) {
+  int32_t result{*first};
+  if (last - first >= 8) {
+    __m256i lanes = load256(first);
+    for (first += 8; last - first >= 8; first += 8) {
+      lanes = _mm256_max_epi32(lanes, load256(first));
+    }
+    alignas(32) int32_t values[8];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(values), lanes);
+    result = max_scalar(values, values + 8, values[0]);
+  }
+  return max_scalar(first, last, result);
+}
+
+SC_SIMD_AVX2 inline float max_avx2(const float *first, const float *last) {
+  float result{*first};
+  if (last - first >= 8) {
+    __m256 lanes = _mm256_loadu_ps(first);
+    for (first += 8; last - first >= 8; first += 8) {
+      lanes = _mm256_max_ps(lanes, _mm256_loadu_ps(first));
+    }
+    alignas(32) float values[8];
+    _mm256_store_ps(values, lanes);
+    result = max_scalar(values, values + 8, values[0]);
+  }
+  return max_scalar(first, last, result);
+}
+
+SC_SIMD_AVX2 inline int64_t sum_avx2(const int32_t *first,
+                                     const int32_t *last) {
+  __m256i low = _mm256_setzero_si256();
+  __m256i high = _mm256_setzero_si256();
+  for (; last - first >= 8; first += 8) {
+    __m128i block_low = load(first);
+    __m128i block_high = load(first + 4);
+    low = _mm256_add_epi64(low, _mm256_cvtepi32_epi64(block_low));
+    high = _mm256_add_epi64(high, _mm256_cvtepi32_epi64(block_high));
+  }
+  alignas(32) int64_t values[4];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(values),
+                     _mm256_add_epi64(low, high));
+  int64_t result{values[0] + values[1] + values[2] + values[3]};
+  return sum_scalar(first, last, result);
+}
+
+SC_SIMD_AVX2 inline float sum_avx2(const float *first, const float *last) {
+  __m256 even = _mm256_setzero_ps();
+  __m256 odd = _mm256_setzero_ps();
+  for (; last - first >= 16; first += 16) {
+    even = _mm256_add_ps(even, _mm256_loadu_ps(first));
+    odd = _mm256_add_ps(odd, _mm256_loadu_ps(first + 8));
+  }
+  alignas(32) float values[8];
+  _mm256_store_ps(values, _mm256_add_ps(even, odd));
+  float result{((values[0] + values[1]) + (values[2] + values[3])) +
+               ((values[4] + values[5]) + (values[6] + values[7]))};
+  return sum_scalar(first, last, result);
+}
+
+#undef SC_SIMD_AVX2
+#endif // SC_SIMD_X86
+} // namespace detail
+
+/// Consults the instruction set the algorithms are dispatched to.
+inline isa instruction_set() { return detail::active(); }
+
+/*!
+ * Changes the instruction set the algorithms are dispatched to, mostly to test
+ * and benchmark each of them on the same machine. Not thread safe, call it
+ * before any thread uses the algorithms.
+ * \param wanted instruction set to use, lowered to the best one supported.
+ * \return instruction set actually selected.
+ */
+inline isa instruction_set(isa wanted) {
+  isa supported{detail::detect()};
+  detail::active() = wanted < supported ? wanted : supported;
+  return detail::active();
+}
+
+/*!
+ * Finds the first element equal to "value" in [first, last).
+ * \return pointer to the element found, or last if there is none.
+ */
+template <typename T>
+const T *find(const T *first, const T *last,
+              const std::remove_cv_t<T> &value) {
+#ifdef SC_SIMD_X86
+  if constexpr (detail::vectorized_v<T>) {
+    switch (detail::active()) {
+    case isa::avx2:
+      return detail::find_avx2(first, last, value);
+    case isa::sse2:
+      return detail::find_sse2(first, last, value);
+    case isa::scalar:
+      break;
+    }
+  }
+#endif
+  return detail::find_scalar(first, last, value);
+}
+
+/// Counts the elements equal to "value" in [first, last).
+template <typename T>
+size_t count(const T *first, const T *last,
+             const std::remove_cv_t<T> &value) {
+#ifdef SC_SIMD_X86
+  if constexpr (detail::vectorized_v<T>) {
+    switch (detail::active()) {
+    case isa::avx2:
+      return detail::count_avx2(first, last, value);
+    case isa::sse2:
+      return detail::count_sse2(first, last, value);
+    case isa::scalar:
+      break;
+    }
+  }
+#endif
+  return detail::count_scalar(first, last, value);
+}
+
+/*!
+ * Finds the smallest element in [first, last), which must not be empty. The
+ * result is unspecified if a floating point range has a NaN.
+ */
+template <typename T> T min(const T *first, const T *last) {
+#ifdef SC_SIMD_X86
+  if constexpr (detail::vectorized_v<T>) {
+    switch (detail::active()) {
+    case isa::avx2:
+      return detail::min_avx2(first, last);
+    case isa::sse2:
+      return detail::min_sse2(first, last);
+    case isa::scalar:
+      break;
+    }
+  }
+#endif
+  return detail::min_scalar(first + 1, last, *first);
+}
+
+/*!
+ * Finds the largest element in [first, last), which must not be empty. The
+ * result is unspecified if a floating point range has a NaN.
+ */
+template <typename T> T max(const T *first, const T *last) {
+#ifdef SC_SIMD_X86
+  if constexpr (detail::vectorized_v<T>) {
+    switch (detail::active()) {
+    case isa::avx2:
+      return detail::max_avx2(first, last);
+    case isa::sse2:
+      return detail::max_sse2(first, last);
+    case isa::scalar:
+      break;
+    }
+  }
+#endif
+  return detail::max_scalar(first + 1, last, *first);
+}
+
+/*!
+ * Adds up the elements in [first, last). Integers are added as 64 bits ones,
+ * floating point ones are added in a different order than a sequential loop,
+ * so the result may differ from std::accumulate by the rounding errors.
+ */
+template <typename T> sum_type<T> sum(const T *first, const T *last) {
+#ifdef SC_SIMD_X86
+  if constexpr (detail::vectorized_v<T>) {
+    switch (detail::active()) {
+    case isa::avx2:
+      return detail::sum_avx2(first, last);
+    case isa::sse2:
+      return detail::sum_sse2(first, last);
+    case isa::scalar:
+      break;
+    }
+  }
+#endif
+  return detail::sum_scalar(first, last, sum_type<T>{});
+}
+
+//=== Overloads for spans.
+/// Finds the first element equal to "value", or end() if there is none.
+template <typename T>
+T *find(span<T> range, const std::remove_cv_t<T> &value) {
+  const std::remove_cv_t<T> *first{range.data()};
+  return range.begin() + (find(first, first + range.size(), value) - first);
+}
+
+/// Counts the elements equal to "value".
+template <typename T>
+size_t count(span<T> range, const std::remove_cv_t<T> &value) {
+  const std::remove_cv_t<T> *first{range.data()};
+  return count(first, first + range.size(), value);
+}
+
+/// Finds the smallest element of a non empty span.
+template <typename T> std::remove_cv_t<T> min(span<T> range) {
+  const std::remove_cv_t<T> *first{range.data()};
+  return min(first, first + range.size());
+}
+
+/// Finds the largest element of a non empty span.
+template <typename T> std::remove_cv_t<T> max(span<T> range) {
+  const std::remove_cv_t<T> *first{range.data()};
+  return max(first, first + range.size());
+}
+
+/// Adds up the elements.
+template <typename T> sum_type<std::remove_cv_t<T>> sum(span<T> range) {
+  const std::remove_cv_t<T> *first{range.data()};
+  return sum(first, first + range.size());
+}
+
+//=== Overloads for sc::vector.
+/// Finds the first element equal to "value", or end() if there is none.
+template <typename T, class G, class A>
+typename vector<T, G, A>::iterator
+find(vector<T, G, A> &list, const typename vector<T, G, A>::value_type &value) {
+  const T *first{list.data()};
+  return list.begin() + (find(first, first + list.size(), value) - first);
+}
+
+/// Finds the first element equal to "value", or end() if there is none.
+template <typename T, class G, class A>
+typename vector<T, G, A>::const_iterator
+find(const vector<T, G, A> &list,
+     const typename vector<T, G, A>::value_type &value) {
+  const T *first{list.data()};
+  return list.begin() + (find(first, first + list.size(), value) - first);
+}
+
+/// Counts the elements equal to "value".
+template <typename T, class G, class A>
+size_t count(const vector<T, G, A> &list,
+             const typename vector<T, G, A>::value_type &value) {
+  return count(list.data(), list.data() + list.size(), value);
+}
+
+/// Finds the smallest element of a non empty vector.
+template <typename T, class G, class A> T min(const vector<T, G, A> &list) {
+  return min(list.data(), list.data() + list.size());
+}
+
+/// Finds the largest element of a non empty vector.
+template <typename T, class G, class A> T max(const vector<T, G, A> &list) {
+  return max(list.data(), list.data() + list.size());
+}
+
+/// Adds up the elements.
+template <typename T, class G, class A>
+sum_type<T> sum(const vector<T, G, A> &list) {
+  return sum(list.data(), list.data() + list.size());
+}
+} // namespace simd
+} // namespace sc
+
+#endif // SRC_INCLUDE_VECTOR_SIMDALGORITHMS_H_
@@ -0,0 +1,698 @@
+#ifndef SRC_INCLUDE_VECTOR_SMALLVECTOR_H_
+#define SRC_INCLUDE_VECTOR_SMALLVECTOR_H_
+
+#include "ArrayOperations.h"
+#include "Vector.h"
+#include <cstddef> // size_t, ptrdiff_t
+#include <initializer_list>
+#include <iterator>        // distance
+#include <memory>          // allocator, allocator_traits
+#include <memory_resource> // polymorphic_allocator
+#include <type_traits>     // enable_if, is_nothrow_move_constructible
+#include <utility>         // move, forward, swap
+
+// Namespace for sequential containers(sc).
+namespace sc {
+/*!
+ * Vector with small buffer optimization. Stores up to N elements inline, in
+ * the object itself, and only allocates memory in the heap when it grows
+ * beyond that, so small vectors cost no allocation at all. Has the same
+ * interface as sc::vector, but swap() moves the inline elements one by one.
+ * \tparam T data type to store.
+ * \tparam N number of elements stored inline.
+ * \tparam GrowthPolicy functor that decides the new capacity when an insertion
+ *         does not fit, see namespace growth. Default = growth::Double.
+ * \tparam Allocator allocator used to acquire the heap memory and to construct
+ *         and destroy the elements, inline ones included, as in sc::vector.
+ *         Its pointer type must be a raw pointer. Default = std::allocator.
+ *
+ * \author Eduardo Marinho (eduardo.nestor.marinho228@gmail.com)
+ */
+template <typename T, size_t N, class GrowthPolicy = growth::Double<T>,
+          class Allocator = std::allocator<T>>
+class small_vector {
+  static_assert(N > 0, "small_vector needs room for at least one element");
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+public:
+  //=== Aliases.
+  using value_type = T;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using allocator_type = Allocator;
+  using iterator = typename vector<T, GrowthPolicy>::iterator;
+  using const_iterator = typename vector<T, GrowthPolicy>::const_iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  //=== [I] Special Functions
+  /// Default constructor. Creates an empty vector.
+  small_vector() = default;
+  /// Creates an empty vector that uses "alloc" to acquire memory.
+  explicit small_vector(const allocator_type &alloc) : m_allocator{alloc} {}
+  /*!
+   * Creates a vector with "count" copies of "value".
+   * \param count number of elements to insert.
+   * \param value data to store in the vector. If not provided, default
+   *        constructor will be used.
+   * \param alloc allocator to acquire memory with.
+   */
+  explicit small_vector(size_type count, const_reference value = T(),
+                        const allocator_type &alloc = allocator_type())
+      : m_allocator{alloc} {
+    reserve(count);
+    detail::construct_fill(m_allocator, m_array, count, value);
+    m_size = count;
+  }
+  /*!
+   * Creates a vector with the same size and the same elements as the ilist.
+   * \param ilist initializer_list with elements to insert in the vector.
+   * \param alloc allocator to acquire memory with.
+   */
+  small_vector(std::initializer_list<value_type> ilist,
+               const allocator_type &alloc = allocator_type())
+      : m_allocator{alloc} {
+    assign(ilist);
+  }
+  /*!
+   * Copy constructor. Creates a vector equivalent to "copy", with the allocator
+   * the allocator of "copy" selects for copies.
+   * \param copy vector to be copied.
+   */
+  small_vector(const small_vector &copy)
+      : small_vector(copy, alloc_traits::select_on_container_copy_construction(
+                               copy.m_allocator)) {}
+  /*!
+   * Creates a vector equivalent to "copy" that uses "alloc" to acquire memory.
+   * \param copy vector to be copied.
+   * \param alloc allocator to acquire memory with.
+   */
+  small_vector(const small_vector &copy, const allocator_type &alloc)
+      : m_allocator{alloc} {
+    reserve(copy.m_size);
+    detail::construct_copy(m_allocator, copy.m_array,
+                           copy.m_array + copy.m_size, m_array);
+    m_size = copy.m_size;
+  }
+  /*!
+   * Move constructor. Takes over the allocator and the heap buffer of "other",
+   * if it has one, otherwise moves its inline elements one by one. "other" is
+   * left empty.
+   * \param other vector to take the elements from.
+   */
+  small_vector(small_vector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>)
+      : m_allocator{std::move(other.m_allocator)} {
+    take(other);
+  }
+  /*!
+   * Creates a vector with the elements of "other" that uses "alloc" to acquire
+   * memory. The heap buffer of "other" is only taken over if "alloc" is equal
+   * to its allocator, otherwise the elements are moved one by one. "other" is
+   * left empty.
+   * \param other vector to take the elements from.
+   * \param alloc allocator to acquire memory with.
+   */
+  small_vector(small_vector &&other, const allocator_type &alloc)
+      : m_allocator{alloc} {
+    if (m_allocator == other.m_allocator) {
+      take(other);
+    } else {
+      move_elements(other);
+    }
+  }
+  /*!
+   * Creates a vector with the data in the range [begin, end).
+   * \param begin beginning of the range.
+   * \param end ending of the range (not included).
+   * \param alloc allocator to acquire memory with.
+   */
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  small_vector(InputIt begin, InputIt end,
+               const allocator_type &alloc = allocator_type())
+      : m_allocator{alloc} {
+    assign(begin, end);
+  }
+  /*!
+   * Makes the vector contain the same data stored in the range [begin, end).
+   * \param begin beginning of the range.
+   * \param end ending of the range (not included).
+   */
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  void assign(InputIt begin, InputIt end) {
+    clear();
+    reserve(std::distance(begin, end));
+    for (; begin != end; ++begin) {
+      push_back(*begin);
+    }
+  }
+  /*!
+   * Makes the vector equal to the ilist.
+   * \param ilist initializer_list with elements to insert in the vector.
+   */
+  void assign(std::initializer_list<value_type> ilist) {
+    assign(ilist.begin(), ilist.end());
+  }
+  /*!
+   * Makes this vector be equivalent to "copy".
+   * \param copy vector to be copied.
+   */
+  small_vector &operator=(const small_vector &copy) {
+    if (this != &copy) {
+      if constexpr (
+          alloc_traits::propagate_on_container_copy_assignment::value) {
+        if (m_allocator != copy.m_allocator) {
+          release();
+        }
+        m_allocator = copy.m_allocator;
+      }
+      assign(copy.m_array, copy.m_array + copy.m_size);
+    }
+    return *this;
+  }
+  /*!
+   * Makes this vector take the elements of "other", which is left empty. The
+   * heap buffer of "other" is taken over, unless the allocators differ and do
+   * not propagate, in which case the elements are moved one by one.
+   * \param other vector to take the elements from.
+   */
+  small_vector &operator=(small_vector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type> &&
+      (alloc_traits::propagate_on_container_move_assignment::value ||
+       alloc_traits::is_always_equal::value)) {
+    if (this == &other) {
+      return *this;
+    }
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+      release();
+      m_allocator = std::move(other.m_allocator);
+      take(other);
+    } else if (m_allocator == other.m_allocator) {
+      release();
+      take(other);
+    } else {
+      clear();
+      move_elements(other);
+    }
+    return *this;
+  }
+  /*!
+   * Makes the vector equal to the ilist.
+   * \param ilist initializer_list with elements to insert in the vector.
+   */
+  small_vector &operator=(std::initializer_list<value_type> ilist) {
+    assign(ilist);
+    return *this;
+  }
+  /// Destroys the elements and deallocates memory, if any.
+  ~small_vector() {
+    clear();
+    if (!is_inline()) {
+      deallocate(m_array, m_capacity);
+    }
+  }
+  /// Consults the allocator associated with the container.
+  allocator_type get_allocator() const { return m_allocator; }
+
+  //=== [II] Element Access
+  /// Access the element in the front of the container.
+  reference front() { return m_array[0]; }
+  /// Access the element in the front of the container.
+  const_reference front() const { return m_array[0]; }
+  /// Access the element in the end of the container.
+  reference back() { return m_array[m_size - 1]; }
+  /// Access the element in the end of the container.
+  const_reference back() const { return m_array[m_size - 1]; }
+  /// Consults the pointer to the underlying array storing the data.
+  pointer data() { return m_array; }
+  /// Consults the pointer to the underlying array storing the data.
+  const_pointer data() const { return m_array; }
+  /// Access the element at the "pos" position in the container.
+  reference at(size_type pos) { return m_array[pos]; }
+  /// Access the element at the "pos" position in the container.
+  const_reference at(size_type pos) const { return m_array[pos]; }
+  /// Access the element at the "pos" position in the container.
+  reference operator[](size_type pos) { return at(pos); }
+  /// Access the element at the "pos" position in the container.
+  const_reference operator[](size_type pos) const { return at(pos); }
+
+  //=== [III] Iterators
+  /*!
+   * Gets a iterator to the beginning of the container.
+   * \return iterator pointing to the beginning of the container.
+   */
+  iterator begin() { return iterator(m_array); }
+  /// Gets a const_iterator to the beginning of the container.
+  const_iterator begin() const { return cbegin(); }
+  /// Gets a const_iterator to the beginning of the container.
+  const_iterator cbegin() const { return const_iterator(m_array); }
+  /*!
+   * Gets a iterator to the element past the last element of  the container.
+   * \return iterator to the element past the last element of the container.
+   */
+  iterator end() { return iterator(m_array + m_size); }
+  /// Gets a const_iterator to the element past the last element.
+  const_iterator end() const { return cend(); }
+  /// Gets a const_iterator to the element past the last element.
+  const_iterator cend() const { return const_iterator(m_array + m_size); }
+  /// Gets a reverse_iterator to the last element of the container.
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  /// Gets a const_reverse_iterator to the last element of the container.
+  const_reverse_iterator rbegin() const { return crbegin(); }
+  /// Gets a const_reverse_iterator to the last element of the container.
+  const_reverse_iterator crbegin() const {
+    return const_reverse_iterator(cend());
+  }
+  /// Gets a reverse_iterator to the element before the first one.
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  /// Gets a const_reverse_iterator to the element before the first one.
+  const_reverse_iterator rend() const { return crend(); }
+  /// Gets a const_reverse_iterator to the element before the first one.
+  const_reverse_iterator crend() const {
+    return const_reverse_iterator(cbegin());
+  }
+
+  //=== [IV] Capacity
+  /// Consults whether the container is empty.
+  bool empty() const { return m_size == 0; }
+  /// Consults the number of elements in the container.
+  size_type size() const { return m_size; }
+  /*!
+   * If new_capacity is greater than the current capacity of the container, the
+   * elements are moved to the heap, with capacity for new_capacity elements.
+   * Otherwise, the function does nothing.
+   * \param new_capacity capacity that the container should have.
+   */
+  void reserve(size_type new_capacity) {
+    if (new_capacity > m_capacity) {
+      reallocate(new_capacity);
+    }
+  }
+  /// Consults the capacity of the container, which is never less than N.
+  size_type capacity() const { return m_capacity; }
+  /// Consults whether the elements are stored inline, i.e. not in the heap.
+  bool is_inline() const { return m_array == inline_buffer(); }
+  /*!
+   * Frees up unused memory, reducing the capacity of the container. Makes
+   * the capacity equal to size, or moves the elements back inline if they fit.
+   * If the capacity changes, all references to elements are invalidated.
+   */
+  void shrink_to_fit() {
+    if (!is_inline() && m_capacity > m_size) {
+      reallocate(m_size);
+    }
+  }
+
+  //=== [V] Modifiers
+  /// Removes all elements of the container, i.e. empties it.
+  void clear() {
+    detail::destroy(m_allocator, m_array, m_array + m_size);
+    m_size = 0;
+  }
+  /*!
+   * Inserts the data "value" before the position pointed by "pos".
+   * \param pos iterator pointing to the element past the position to insert.
+   * \param value data to insert.
+   * \return iterator pointing to the inserted value.
+   */
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+  /*!
+   * Inserts the data "value" before the position pointed by "pos", moving it
+   * into the container.
+   * \param pos iterator pointing to the element past the position to insert.
+   * \param value data to insert.
+   * \return iterator pointing to the inserted value.
+   */
+  iterator insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+  /*!
+   * Inserts "count" copies of "value" before position pointed by "pos".
+   * \param pos iterator pointing to the element past the position to insert.
+   * \param count number of copies to insert.
+   * \param value data to insert.
+   * \return iterator pointing to the first element inserted, or "pos" if
+   *         "count" == 0.
+   */
+  iterator insert(const_iterator pos, size_type count, const_reference value) {
+    size_type pos_index = pos - cbegin();
+    // "value" may be an element, which the reallocation or the gap would move.
+    value_type copy(value);
+    if (m_capacity < m_size + count) {
+      reserve(next_capacity(m_size + count));
+    }
+    detail::insert_gap(m_allocator, m_array, m_size, pos_index, count,
+                       [&](pointer gap) {
+                         detail::construct_fill(m_allocator, gap, count, copy);
+                       });
+    return iterator(m_array + pos_index);
+  }
+  /*!
+   * Inserts elements in range [first, last) before position pointed by "pos".
+   * \param first beginning of the range of elements.
+   * \param last end of the range of elements.
+   * \return iterator pointing to the first element inserted, or "pos" if
+   * "first" == "last".
+   */
+  template <class InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type pos_index = pos - cbegin();
+    size_type number_elements = std::distance(first, last);
+    if (m_capacity < m_size + number_elements) {
+      reserve(next_capacity(m_size + number_elements));
+    }
+    detail::insert_gap(m_allocator, m_array, m_size, pos_index, number_elements,
+                       [&](pointer gap) {
+                         detail::construct_copy(m_allocator, first, last, gap);
+                       });
+    return iterator(m_array + pos_index);
+  }
+  /*!
+   * Inserts elements from "ilist" before position pointed by "pos".
+   * \param pos iterator pointing to the element past the position to insert.
+   * \param ilist initializer_list with elements to insert.
+   * \return iterator pointing to first element inserted, or "pos" if "ilist" is
+   *         empty.
+   */
+  iterator insert(const_iterator pos, std::initializer_list<T> ilist) {
+    return insert(pos, ilist.begin(), ilist.end());
+  }
+  /*!
+   * Removes the element pointed by "pos".
+   * \param pos iterator pointing to the element to remove.
+   * \return iterator pointing to the element past the removed one. Note, that
+   *         it can return end().
+   */
+  iterator erase(const_iterator pos) {
+    size_type pos_index = pos - cbegin();
+    detail::close_gap(m_allocator, m_array, m_size, pos_index, 1);
+    return iterator(m_array + pos_index);
+  }
+  /*!
+   * Removes the range of elements ["first", "last").
+   * \param first iterator pointing to the beginning of the range.
+   * \param last iterator pointing to the end of the range (not included).
+   * \return iterator pointing to the element past the removed one. Note, that
+   *         it can return end().
+   */
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type first_index = first - cbegin();
+    detail::close_gap(m_allocator, m_array, m_size, first_index, last - first);
+    return iterator(m_array + first_index);
+  }
+  /*!
+   * Changes the size of the container. If new_size > size, increases size
+   * of the container inserting copies of "value". If new_size < size, reduces
+   * the size of the container. Otherwise, do nothing.
+   * \param new_size new size of the container.
+   * \param value data to store in case on need. If not provided, default
+   *        constructor will be used.
+   */
+  void resize(size_type new_size, const_reference value = value_type()) {
+    if (new_size > m_size) {
+      if (new_size > m_capacity) {
+        // "value" may be an element, so it is copied before the reallocation.
+        value_type copy(value);
+        reserve(next_capacity(new_size));
+        detail::construct_fill(m_allocator, m_array + m_size,
+                               new_size - m_size, copy);
+      } else {
+        detail::construct_fill(m_allocator, m_array + m_size,
+                               new_size - m_size, value);
+      }
+    } else {
+      detail::destroy(m_allocator, m_array + new_size, m_array + m_size);
+    }
+    m_size = new_size;
+  }
+  /*!
+   * Constructs an element in place before the position pointed by "pos".
+   * \param pos iterator pointing to the element past the position to insert.
+   * \param args arguments to forward to the constructor of the element.
+   * \return iterator pointing to the inserted element.
+   */
+  template <typename... Args> iterator emplace(const_iterator pos,
+                                              Args &&...args) {
+    size_type pos_index = pos - cbegin();
+    if (pos_index == m_size) {
+      emplace_back(std::forward<Args>(args)...);
+    } else {
+      // The arguments may refer to elements of the container, which are
+      // about to be moved, so the new element is built before that.
+      value_type tmp(std::forward<Args>(args)...);
+      if (m_size == m_capacity) {
+        reserve(next_capacity(m_size + 1));
+      }
+      detail::insert_gap(m_allocator, m_array, m_size, pos_index, 1,
+                         [&](pointer gap) { construct(gap, std::move(tmp)); });
+    }
+    return iterator(m_array + pos_index);
+  }
+  /*!
+   * Constructs an element in place in the end of the container.
+   * \param args arguments to forward to the constructor of the element.
+   * \return reference to the inserted element.
+   */
+  template <typename... Args> reference emplace_back(Args &&...args) {
+    if (m_size == m_capacity) {
+      return grow_and_emplace_back(std::forward<Args>(args)...);
+    }
+    construct(m_array + m_size, std::forward<Args>(args)...);
+    return m_array[m_size++];
+  }
+  /*!
+   * Inserts a element in the end of the container.
+   * \param value data to store.
+   */
+  void push_back(const_reference value) { emplace_back(value); }
+  /*!
+   * Inserts a element in the end of the container, moving it.
+   * \param value data to store.
+   */
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+  /// Removes the element in the end of the container, which must not be empty.
+  void pop_back() {
+    --m_size;
+    detail::destroy(m_allocator, m_array + m_size, m_array + m_size + 1);
+  }
+  /*!
+   * Inserts "count" elements in the end of the container, built directly in
+   * its uninitialized storage by "construct", as vector::append_uninitialized()
+   * does. The elements are not constructed through the allocator.
+   * \param count number of elements to insert.
+   * \param construct function that receives a pointer to the storage of the
+   *        new elements and must construct all of them. If it throws, it must
+   *        not leave any of them constructed, the size is not changed then.
+   */
+  template <typename Construct>
+  void append_uninitialized(size_type count, Construct construct) {
+    if (m_size + count > m_capacity) {
+      reserve(next_capacity(m_size + count));
+    }
+    construct(m_array + m_size);
+    m_size += count;
+  }
+  /*!
+   * Exchanges the contents of this vector with the ones of "other". Heap
+   * buffers are exchanged without touching the elements, inline elements are
+   * moved one by one. The allocators are only exchanged if they propagate on
+   * swap, otherwise they must be equal.
+   * \param other vector to exchange contents with.
+   */
+  void swap(small_vector &other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (this == &other) {
+      return;
+    }
+    if (is_inline() || other.is_inline()) {
+      small_vector tmp(m_allocator);
+      tmp.take(*this);
+      take(other);
+      other.take(tmp);
+    } else {
+      std::swap(m_array, other.m_array);
+      std::swap(m_size, other.m_size);
+      std::swap(m_capacity, other.m_capacity);
+    }
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      std::swap(m_allocator, other.m_allocator);
+    }
+  }
+  /*!
+   * Inserts a element in the beginning of the container.
+   * \param value data to store.
+   */
+  void push_front(const_reference value) { emplace(begin(), value); }
+  /*!
+   * Inserts a element in the beginning of the container, moving it.
+   * \param value data to store.
+   */
+  void push_front(value_type &&value) { emplace(begin(), std::move(value)); }
+
+private:
+  //=== Auxiliary Functions.
+  /// Consults the pointer to the inline buffer.
+  pointer inline_buffer() { return reinterpret_cast<pointer>(m_buffer); }
+  /// Consults the pointer to the inline buffer.
+  const_pointer inline_buffer() const {
+    return reinterpret_cast<const_pointer>(m_buffer);
+  }
+  /// Allocates uninitialized heap memory for "count" elements.
+  pointer allocate(size_type count) {
+    return alloc_traits::allocate(m_allocator, count);
+  }
+  /*!
+   * Deallocates memory obtained with allocate(). Does not destroy elements.
+   * \param array memory to deallocate.
+   * \param count number of elements the memory was allocated for.
+   */
+  void deallocate(pointer array, size_type count) {
+    alloc_traits::deallocate(m_allocator, array, count);
+  }
+  /// Constructs an element at "location" with the allocator.
+  template <typename... Args> void construct(pointer location, Args &&...args) {
+    alloc_traits::construct(m_allocator, location, std::forward<Args>(args)...);
+  }
+  /*!
+   * Moves the elements to a buffer with capacity for "new_capacity" elements,
+   * which must not be less than the size. The inline buffer is used whenever
+   * it is big enough, otherwise a heap buffer is allocated.
+   * \param new_capacity capacity of the new buffer.
+   */
+  void reallocate(size_type new_capacity) {
+    pointer tmp = inline_buffer();
+    if (new_capacity > N) {
+      tmp = allocate(new_capacity);
+    } else if (is_inline()) {
+      return;
+    } else {
+      new_capacity = N;
+    }
+    try {
+      detail::relocate(m_allocator, m_array, m_array + m_size, tmp);
+    } catch (...) {
+      if (tmp != inline_buffer()) {
+        deallocate(tmp, new_capacity);
+      }
+      throw;
+    }
+    if (!is_inline()) {
+      deallocate(m_array, m_capacity);
+    }
+    m_array = tmp;
+    m_capacity = new_capacity;
+  }
+  /// Destroys the elements and deallocates the heap buffer, if any.
+  void release() {
+    clear();
+    if (!is_inline()) {
+      deallocate(m_array, m_capacity);
+      m_array = inline_buffer();
+      m_capacity = N;
+    }
+  }
+  /*!
+   * Takes the elements of "other", which is left empty and inline. This
+   * vector must be empty and inline, and its allocator must be able to
+   * deallocate the heap buffer of "other".
+   * \param other vector to take the elements from.
+   */
+  void take(small_vector &other) {
+    if (other.is_inline()) {
+      detail::relocate(m_allocator, other.m_array,
+                     other.m_array + other.m_size, m_array);
+    } else {
+      m_array = other.m_array;
+      m_capacity = other.m_capacity;
+      other.m_array = other.inline_buffer();
+      other.m_capacity = N;
+    }
+    m_size = other.m_size;
+    other.m_size = 0;
+  }
+  /*!
+   * Moves the elements of "other" one by one to this vector, which must be
+   * empty. "other" is left empty, but keeps its buffer.
+   * \param other vector to take the elements from.
+   */
+  void move_elements(small_vector &other) {
+    reserve(other.m_size);
+    detail::relocate(m_allocator, other.m_array,
+                     other.m_array + other.m_size, m_array);
+    m_size = other.m_size;
+    other.m_size = 0;
+  }
+  /*!
+   * Consults the capacity to grow to, according to the growth policy.
+   * \param required minimum capacity needed by the insertion.
+   * \return new capacity, not less than "required".
+   */
+  size_type next_capacity(size_type required) const {
+    return GrowthPolicy{}(m_capacity, required);
+  }
+  /*!
+   * Moves the elements to a bigger buffer, constructing a new element in its
+   * end. The new element is constructed before the others are moved, because
+   * the arguments may refer to them.
+   * \param args arguments to forward to the constructor of the element.
+   * \return reference to the inserted element.
+   */
+  template <typename... Args>
+  reference grow_and_emplace_back(Args &&...args) {
+    size_type new_capacity = next_capacity(m_size + 1);
+    pointer tmp = allocate(new_capacity);
+    try {
+      construct(tmp + m_size, std::forward<Args>(args)...);
+    } catch (...) {
+      deallocate(tmp, new_capacity);
+      throw;
+    }
+    try {
+      detail::relocate(m_allocator, m_array, m_array + m_size, tmp);
+    } catch (...) {
+      detail::destroy(m_allocator, tmp + m_size, tmp + m_size + 1);
+      deallocate(tmp, new_capacity);
+      throw;
+    }
+    if (!is_inline()) {
+      deallocate(m_array, m_capacity);
+    }
+    m_array = tmp;
+    m_capacity = new_capacity;
+    return m_array[m_size++];
+  }
+
+  pointer m_array{inline_buffer()}; //!< Pointer to the elements.
+  size_type m_size{0};              //!< Number of elements in the container.
+  size_type m_capacity{N};          //!< Capacity of the container.
+  allocator_type m_allocator{};     //!< Allocator that owns the heap memory.
+  alignas(value_type) unsigned char
+      m_buffer[N * sizeof(value_type)]; //!< Inline storage for N elements.
+};
+
+/// Exchanges the contents of "lhs" and "rhs", see small_vector::swap().
+template <typename T, size_t N, class GrowthPolicy, class Allocator>
+void swap(small_vector<T, N, GrowthPolicy, Allocator> &lhs,
+          small_vector<T, N, GrowthPolicy, Allocator> &rhs) noexcept(
+    noexcept(lhs.swap(rhs))) {
+  lhs.swap(rhs);
+}
+
+// Small vectors that acquire memory from a std::pmr::memory_resource.
+namespace pmr {
+template <typename T, size_t N, class GrowthPolicy = growth::Double<T>>
+using small_vector =
+    sc::small_vector<T, N, GrowthPolicy, std::pmr::polymorphic_allocator<T>>;
+} // namespace pmr
+} // namespace sc
+
+#endif // SRC_INCLUDE_VECTOR_SMALLVECTOR_H_
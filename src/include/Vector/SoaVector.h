@@ -0,0 +1,427 @@
+#ifndef SRC_INCLUDE_VECTOR_SOAVECTOR_H_
+#define SRC_INCLUDE_VECTOR_SOAVECTOR_H_
+
+#include "Span.h"
+#include "Vector.h"
+#include <cstddef> // size_t, ptrdiff_t
+#include <initializer_list>
+#include <iterator> // input_iterator_tag
+#include <tuple>
+#include <type_traits> // conditional_t, enable_if_t
+#include <utility>     // index_sequence, forward, move
+
+// Namespace for sequential containers(sc).
+namespace sc {
+/*!
+ * Vector that stores records in the structure of arrays layout: each field is
+ * kept in its own contiguous column, an sc::vector, instead of the fields of a
+ * record being kept together. A scan that only reads some of the fields then
+ * streams through those columns only, without loading the others in the cache.
+ * \tparam Fields data types of the fields of a record, one column each.
+ *
+ * \author Eduardo Marinho (eduardo.nestor.marinho228@gmail.com)
+ */
+template <typename... Fields> class soa_vector {
+  static_assert(sizeof...(Fields) > 0, "soa_vector needs at least one field");
+
+public:
+  // Forward declaration.
+  template <bool Const> class SoaIterator;
+  //=== Aliases.
+  using value_type = std::tuple<Fields...>;
+  using reference = std::tuple<Fields &...>;
+  using const_reference = std::tuple<const Fields &...>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using iterator = SoaIterator<false>;
+  using const_iterator = SoaIterator<true>;
+  /// Data type of the field at "Index".
+  template <size_t Index>
+  using field_type = std::tuple_element_t<Index, value_type>;
+
+  //=== [I] Special Functions
+  /// Default constructor. Creates an empty container.
+  soa_vector() = default;
+  /*!
+   * Creates a container with "count" copies of "value".
+   * \param count number of records to insert.
+   * \param value record to store. If not provided, default constructor will be
+   *        used.
+   */
+  explicit soa_vector(size_type count, const value_type &value = value_type()) {
+    resize(count, value);
+  }
+  /*!
+   * Creates a container with the records in the ilist.
+   * \param ilist initializer_list with records to insert.
+   */
+  soa_vector(std::initializer_list<value_type> ilist) {
+    reserve(ilist.size());
+    for (const value_type &value : ilist) {
+      push_back(value);
+    }
+  }
+
+  //=== [II] Element Access
+  /// Access the record at the "pos" position, as a tuple of references.
+  reference operator[](size_type pos) {
+    return record_at(pos, std::index_sequence_for<Fields...>{});
+  }
+  /// Access the record at the "pos" position, as a tuple of references.
+  const_reference operator[](size_type pos) const {
+    return record_at(pos, std::index_sequence_for<Fields...>{});
+  }
+  /// Access the record in the front of the container.
+  reference front() { return (*this)[0]; }
+  /// Access the record in the front of the container.
+  const_reference front() const { return (*this)[0]; }
+  /// Access the record in the end of the container.
+  reference back() { return (*this)[size() - 1]; }
+  /// Access the record in the end of the container.
+  const_reference back() const { return (*this)[size() - 1]; }
+  /*!
+   * Gets the column with the field at "Index" of every record.
+   * \tparam Index index of the field.
+   * \return span over the contiguous column.
+   */
+  template <size_t Index> span<field_type<Index>> column() {
+    auto &column = std::get<Index>(m_columns);
+    return span<field_type<Index>>(column.data(), column.size());
+  }
+  /*!
+   * Gets the column with the field at "Index" of every record.
+   * \tparam Index index of the field.
+   * \return read only span over the contiguous column.
+   */
+  template <size_t Index> span<const field_type<Index>> column() const {
+    const auto &column = std::get<Index>(m_columns);
+    return span<const field_type<Index>>(column.data(), column.size());
+  }
+
+  //=== [III] Iterators
+  /// Gets a iterator to the first record.
+  iterator begin() { return iterator(data_pointers(), 0); }
+  /// Gets a const_iterator to the first record.
+  const_iterator begin() const { return cbegin(); }
+  /// Gets a const_iterator to the first record.
+  const_iterator cbegin() const { return const_iterator(data_pointers(), 0); }
+  /// Gets a iterator to the record past the last one.
+  iterator end() { return iterator(data_pointers(), size()); }
+  /// Gets a const_iterator to the record past the last one.
+  const_iterator end() const { return cend(); }
+  /// Gets a const_iterator to the record past the last one.
+  const_iterator cend() const {
+    return const_iterator(data_pointers(), size());
+  }
+
+  //=== [IV] Capacity
+  /// Consults whether the container is empty.
+  bool empty() const { return size() == 0; }
+  /// Consults the number of records in the container.
+  size_type size() const { return std::get<0>(m_columns).size(); }
+  /// Consults the number of records the columns can hold without growing.
+  size_type capacity() const { return std::get<0>(m_columns).capacity(); }
+  /// Makes every column able to hold at least "new_capacity" records.
+  void reserve(size_type new_capacity) {
+    std::apply(
+        [new_capacity](auto &...column) {
+          (column.reserve(new_capacity), ...);
+        },
+        m_columns);
+  }
+  /// Frees up unused memory of every column.
+  void shrink_to_fit() {
+    std::apply([](auto &...column) { (column.shrink_to_fit(), ...); },
+               m_columns);
+  }
+
+  //=== [V] Modifiers
+  /// Removes all records of the container, i.e. empties it.
+  void clear() {
+    std::apply([](auto &...column) { (column.clear(), ...); }, m_columns);
+  }
+  /*!
+   * Inserts a record in the end of the container, copying each field to its
+   * column.
+   * \param value record to store.
+   */
+  void push_back(const value_type &value) {
+    std::apply([this](const Fields &...fields) { emplace_back(fields...); },
+               value);
+  }
+  /*!
+   * Inserts a record in the end of the container, moving each field to its
+   * column.
+   * \param value record to store.
+   */
+  void push_back(value_type &&value) {
+    std::apply(
+        [this](Fields &...fields) { emplace_back(std::move(fields)...); },
+        value);
+  }
+  /*!
+   * Inserts a record in the end of the container, constructing each field in
+   * place from the corresponding argument.
+   * \param fields one argument for each field of the record.
+   * \return reference to the inserted record.
+   */
+  template <typename... Args> reference emplace_back(Args &&...fields) {
+    static_assert(sizeof...(Args) == sizeof...(Fields),
+                  "emplace_back needs one argument per field");
+    emplace_back_fields(std::index_sequence_for<Fields...>{},
+                        std::forward<Args>(fields)...);
+    return back();
+  }
+  /// Removes the record in the end of the container.
+  void pop_back() {
+    std::apply([](auto &...column) { (column.pop_back(), ...); }, m_columns);
+  }
+  /*!
+   * Changes the number of records of the container, inserting copies of
+   * "value" or removing records from the end.
+   * \param new_size new number of records.
+   * \param value record to store in case on need. If not provided, default
+   *        constructor will be used.
+   */
+  void resize(size_type new_size, const value_type &value = value_type()) {
+    resize_fields(new_size, value, std::index_sequence_for<Fields...>{});
+  }
+
+  /*!
+   * Iterator that walks all columns in lockstep. Dereferencing gives a tuple
+   * of references to the fields of a record. Since that is a proxy and not a
+   * real reference, the iterator is only declared an input iterator, so that
+   * algorithms that swap elements through it, like std::sort, do not accept
+   * it. It still has the operations of a random access iterator, as members.
+   * \tparam Const whether the fields are accessed as const.
+   */
+  template <bool Const> class SoaIterator {
+  public:
+    //=== Aliases.
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::tuple<Fields...>;
+    using reference = std::conditional_t<Const, std::tuple<const Fields &...>,
+                                         std::tuple<Fields &...>>;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+    using pointers =
+        std::conditional_t<Const, std::tuple<const Fields *...>,
+                           std::tuple<Fields *...>>;
+
+    /// Default constructor. Creates a iterator that points to nothing.
+    SoaIterator() = default;
+    /*!
+     * Constructs the iterator.
+     * \param columns pointers to the beginning of every column.
+     * \param index index of the record to point to.
+     */
+    SoaIterator(pointers columns, difference_type index)
+        : m_columns{columns}, m_index{index} {}
+    /// Converts a iterator into a const_iterator.
+    template <bool OtherConst,
+              typename = std::enable_if_t<Const && !OtherConst>>
+    SoaIterator(const SoaIterator<OtherConst> &other)
+        : m_columns{other.m_columns}, m_index{other.m_index} {}
+    /// Dereference operator.
+    reference operator*() const { return (*this)[0]; }
+    /// Access the record "offset" positions away.
+    reference operator[](difference_type offset) const {
+      return std::apply(
+          [this, offset](auto *...column) {
+            return reference(column[m_index + offset]...);
+          },
+          m_columns);
+    }
+    /// Access the field at "Index" of the record pointed to.
+    template <size_t Index> decltype(auto) get() const {
+      return std::get<Index>(m_columns)[m_index];
+    }
+    /// Pre-increment.
+    SoaIterator &operator++() {
+      ++m_index;
+      return *this;
+    }
+    /// Pos-increment.
+    SoaIterator operator++(int) {
+      SoaIterator copy = *this;
+      ++m_index;
+      return copy;
+    }
+    /// Pre-decrement.
+    SoaIterator &operator--() {
+      --m_index;
+      return *this;
+    }
+    /// Pos-decrement.
+    SoaIterator operator--(int) {
+      SoaIterator copy = *this;
+      --m_index;
+      return copy;
+    }
+    /// Advances the iterator "increment" positions.
+    SoaIterator &operator+=(difference_type increment) {
+      m_index += increment;
+      return *this;
+    }
+    /// Moves the iterator back "decrement" positions.
+    SoaIterator &operator-=(difference_type decrement) {
+      m_index -= decrement;
+      return *this;
+    }
+    /// Increment operator.
+    friend SoaIterator operator+(SoaIterator it, difference_type increment) {
+      return it += increment;
+    }
+    /// Increment operator.
+    friend SoaIterator operator+(difference_type increment, SoaIterator it) {
+      return it += increment;
+    }
+    /// Decrement operator.
+    friend SoaIterator operator-(SoaIterator it, difference_type decrement) {
+      return it -= decrement;
+    }
+    /// Difference operator, the number of records between two iterators.
+    friend difference_type operator-(const SoaIterator &left,
+                                     const SoaIterator &right) {
+      return left.m_index - right.m_index;
+    }
+    /// Checks whether two iterator are equal.
+    friend bool operator==(const SoaIterator &left, const SoaIterator &right) {
+      return left.m_index == right.m_index;
+    }
+    /// Checks whether two iterator are different.
+    friend bool operator!=(const SoaIterator &left, const SoaIterator &right) {
+      return left.m_index != right.m_index;
+    }
+    /// Checks whether "left" points before "right".
+    friend bool operator<(const SoaIterator &left, const SoaIterator &right) {
+      return left.m_index < right.m_index;
+    }
+    /// Checks whether "left" points after "right".
+    friend bool operator>(const SoaIterator &left, const SoaIterator &right) {
+      return right < left;
+    }
+    /// Checks whether "left" does not point after "right".
+    friend bool operator<=(const SoaIterator &left, const SoaIterator &right) {
+      return !(right < left);
+    }
+    /// Checks whether "left" does not point before "right".
+    friend bool operator>=(const SoaIterator &left, const SoaIterator &right) {
+      return !(left < right);
+    }
+
+  private:
+    template <bool> friend class SoaIterator;
+    pointers m_columns{};       //!< Pointers to the beginning of the columns.
+    difference_type m_index{0}; //!< Index of the record pointed to.
+  };
+
+private:
+  //=== Auxiliary Functions.
+  /// Builds a tuple with references to the fields of the record at "pos".
+  template <size_t... Indexes>
+  reference record_at(size_type pos, std::index_sequence<Indexes...>) {
+    return reference(std::get<Indexes>(m_columns)[pos]...);
+  }
+  /// Builds a tuple with references to the fields of the record at "pos".
+  template <size_t... Indexes>
+  const_reference record_at(size_type pos,
+                            std::index_sequence<Indexes...>) const {
+    return const_reference(std::get<Indexes>(m_columns)[pos]...);
+  }
+  /*!
+   * Constructs each field in the end of its column. Every column has room for
+   * the record before the first field is constructed, so none of them grows
+   * while the others are changed, and if a field throws the fields already
+   * constructed are removed, leaving the columns with the same length.
+   * \param fields one argument for each field of the record.
+   */
+  template <size_t... Indexes, typename... Args>
+  void emplace_back_fields(std::index_sequence<Indexes...> indexes,
+                           Args &&...fields) {
+    if (full()) {
+      // The arguments may refer to records of the container, so the record is
+      // built before the columns grow.
+      value_type record(std::forward<Args>(fields)...);
+      reserve(growth::Double<value_type>{}(capacity(), size() + 1));
+      push_fields(indexes, std::get<Indexes>(std::move(record))...);
+    } else {
+      push_fields(indexes, std::forward<Args>(fields)...);
+    }
+  }
+  /*!
+   * Constructs each field in the end of its column, which must have room for
+   * it. If a field throws, the fields before it are removed.
+   * \param fields one argument for each field of the record.
+   */
+  template <size_t... Indexes, typename... Args>
+  void push_fields(std::index_sequence<Indexes...>, Args &&...fields) {
+    size_type pushed{0};
+    try {
+      ((std::get<Indexes>(m_columns).emplace_back(std::forward<Args>(fields)),
+        ++pushed),
+       ...);
+    } catch (...) {
+      ((Indexes < pushed ? std::get<Indexes>(m_columns).pop_back() : void()),
+       ...);
+      throw;
+    }
+  }
+  /// Consults whether some column has no room for another record.
+  bool full() const {
+    return std::apply(
+        [](const auto &...column) {
+          return ((column.size() == column.capacity()) || ...);
+        },
+        m_columns);
+  }
+  /*!
+   * Resizes each column, filling with the corresponding field of "value". If
+   * a field throws, the columns already resized go back to their size.
+   */
+  template <size_t... Indexes>
+  void resize_fields(size_type new_size, const value_type &value,
+                     std::index_sequence<Indexes...>) {
+    size_type old_size = size();
+    size_type resized{0};
+    try {
+      ((std::get<Indexes>(m_columns).resize(new_size,
+                                            std::get<Indexes>(value)),
+        ++resized),
+       ...);
+    } catch (...) {
+      ((Indexes < resized ? truncate(std::get<Indexes>(m_columns), old_size)
+                          : void()),
+       ...);
+      throw;
+    }
+  }
+  /// Removes the elements of "column" past the first "new_size" ones.
+  template <typename Column>
+  static void truncate(Column &column, size_type new_size) {
+    while (column.size() > new_size) {
+      column.pop_back();
+    }
+  }
+  /// Consults the pointers to the beginning of every column.
+  std::tuple<Fields *...> data_pointers() {
+    return std::apply(
+        [](auto &...column) {
+          return std::tuple<Fields *...>(column.data()...);
+        },
+        m_columns);
+  }
+  /// Consults the pointers to the beginning of every column.
+  std::tuple<const Fields *...> data_pointers() const {
+    return std::apply(
+        [](const auto &...column) {
+          return std::tuple<const Fields *...>(column.data()...);
+        },
+        m_columns);
+  }
+
+  std::tuple<vector<Fields>...> m_columns; //!< One column for each field.
+};
+} // namespace sc
+
+#endif // SRC_INCLUDE_VECTOR_SOAVECTOR_H_
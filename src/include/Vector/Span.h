@@ -0,0 +1,51 @@
+#ifndef SRC_INCLUDE_VECTOR_SPAN_H_
+#define SRC_INCLUDE_VECTOR_SPAN_H_
+
+#include <cstddef>     // size_t
+#include <type_traits> // remove_cv_t
+
+// Namespace for sequential containers(sc).
+namespace sc {
+/*!
+ * Non-owning view of a contiguous sequence of elements, like std::span of
+ * C++20.
+ * \tparam T data type of the elements, const qualified for read only views.
+ */
+template <typename T> class span {
+public:
+  //=== Aliases.
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using pointer = T *;
+  using reference = T &;
+  using size_type = size_t;
+  using iterator = pointer;
+
+  /// Creates a empty span.
+  span() = default;
+  /*!
+   * Creates a span of "size" elements starting at "data".
+   * \param data pointer to the first element.
+   * \param size number of elements.
+   */
+  span(pointer data, size_type size) : m_data{data}, m_size{size} {}
+  /// Consults the pointer to the first element.
+  pointer data() const { return m_data; }
+  /// Consults the number of elements.
+  size_type size() const { return m_size; }
+  /// Consults whether the span is empty.
+  bool empty() const { return m_size == 0; }
+  /// Access the element at the "pos" position.
+  reference operator[](size_type pos) const { return m_data[pos]; }
+  /// Gets a iterator to the first element.
+  iterator begin() const { return m_data; }
+  /// Gets a iterator to the element past the last one.
+  iterator end() const { return m_data + m_size; }
+
+private:
+  pointer m_data{nullptr}; //!< Pointer to the first element.
+  size_type m_size{0};     //!< Number of elements.
+};
+} // namespace sc
+
+#endif // SRC_INCLUDE_VECTOR_SPAN_H_
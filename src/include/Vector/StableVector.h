@@ -0,0 +1,487 @@
+#ifndef SRC_INCLUDE_VECTOR_STABLEVECTOR_H_
+#define SRC_INCLUDE_VECTOR_STABLEVECTOR_H_
+
+#include "Vector.h"
+#include <cstddef> // size_t, ptrdiff_t
+#include <initializer_list>
+#include <iterator>    // random_access_iterator_tag, reverse_iterator
+#include <memory>      // allocator
+#include <new>         // placement new
+#include <type_traits> // conditional_t, enable_if_t, is_const_v
+#include <utility>     // forward, move, swap
+
+// Namespace for sequential containers(sc).
+namespace sc {
+/*!
+ * Number of elements of type T that fit in "Bytes" bytes, rounded up to a
+ * power of two and never less than 16, used as the default size of the
+ * chunks of a stable_vector.
+ */
+template <typename T, size_t Bytes = 4096> constexpr size_t chunk_elements() {
+  size_t wanted{Bytes / sizeof(T) < 16 ? 16 : Bytes / sizeof(T)};
+  size_t result{1};
+  while (result < wanted) {
+    result <<= 1;
+  }
+  return result;
+}
+
+/*!
+ * Vector that never moves its elements: it grows by allocating a new chunk of
+ * ChunkSize elements and appending it to a directory of chunks, instead of
+ * reallocating all the elements as sc::vector does. Pointers and references
+ * to the elements remain valid until the elements are removed, and so do the
+ * iterators, except end(). Access by index is O(1), it looks up the chunk in
+ * the directory with a shift and the element in the chunk with a mask.
+ *
+ * The worst case of an insertion in the end is allocating one chunk, plus
+ * growing the directory, which only copies ChunkSize times fewer pointers than
+ * there are elements. After reserve() neither happens, so the insertions up to
+ * the reserved capacity take constant time. Since the elements cannot move,
+ * there is no insertion nor removal in the middle.
+ * \tparam T data type to store.
+ * \tparam ChunkSize number of elements per chunk, a power of two. Default =
+ *         the number of elements that fit in 4 KiB.
+ *
+ * \author Eduardo Marinho (eduardo.nestor.marinho228@gmail.com)
+ */
+template <typename T, size_t ChunkSize = chunk_elements<T>()>
+class stable_vector {
+  static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0,
+                "the chunk size of a stable_vector must be a power of two");
+
+  template <typename Value> class StableVectorIterator;
+
+public:
+  //=== Aliases.
+  using value_type = T;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using iterator = StableVectorIterator<value_type>;
+  using const_iterator = StableVectorIterator<const value_type>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  //=== [I] Special Functions
+  /// Default constructor. Creates an empty vector, without any chunk.
+  stable_vector() = default;
+  /*!
+   * Creates a vector with "count" copies of "value".
+   * \param count number of elements to insert.
+   * \param value data to store in the vector. If not provided, default
+   *        constructor will be used.
+   */
+  explicit stable_vector(size_type count, const_reference value = T()) {
+    resize(count, value);
+  }
+  /*!
+   * Creates a vector with the same size and the same elements as the ilist.
+   * \param ilist initializer_list with elements to insert in the vector.
+   */
+  stable_vector(std::initializer_list<value_type> ilist) { assign(ilist); }
+  /*!
+   * Creates a vector with the data in the range [begin, end).
+   * \param begin beginning of the range.
+   * \param end ending of the range (not included).
+   */
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  stable_vector(InputIt begin, InputIt end) {
+    assign(begin, end);
+  }
+  /*!
+   * Copy constructor. Creates a vector equivalent to "copy".
+   * \param copy vector to be copied.
+   */
+  stable_vector(const stable_vector &copy) {
+    assign(copy.begin(), copy.end());
+  }
+  /*!
+   * Move constructor. Takes over the chunks of "other", which is left empty,
+   * so the references to its elements now refer to elements of this vector.
+   * \param other vector to take the chunks from.
+   */
+  stable_vector(stable_vector &&other) noexcept { swap(other); }
+  /*!
+   * Makes this vector be equivalent to "copy".
+   * \param copy vector to be copied.
+   */
+  stable_vector &operator=(const stable_vector &copy) {
+    if (this != &copy) {
+      assign(copy.begin(), copy.end());
+    }
+    return *this;
+  }
+  /*!
+   * Makes this vector take the chunks of "other", which is left empty.
+   * \param other vector to take the chunks from.
+   */
+  stable_vector &operator=(stable_vector &&other) noexcept {
+    if (this != &other) {
+      release();
+      swap(other);
+    }
+    return *this;
+  }
+  /*!
+   * Makes the vector equal to the ilist.
+   * \param ilist initializer_list with elements to insert in the vector.
+   */
+  stable_vector &operator=(std::initializer_list<value_type> ilist) {
+    assign(ilist);
+    return *this;
+  }
+  /// Destroys the elements and deallocates the chunks.
+  ~stable_vector() { release(); }
+  /*!
+   * Makes the vector contain the same data stored in the range [begin, end).
+   * The chunks already allocated are reused.
+   * \param begin beginning of the range.
+   * \param end ending of the range (not included).
+   */
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  void assign(InputIt begin, InputIt end) {
+    clear();
+    for (; begin != end; ++begin) {
+      emplace_back(*begin);
+    }
+  }
+  /*!
+   * Makes the vector equal to the ilist.
+   * \param ilist initializer_list with elements to insert in the vector.
+   */
+  void assign(std::initializer_list<value_type> ilist) {
+    reserve(ilist.size());
+    assign(ilist.begin(), ilist.end());
+  }
+
+  //=== [II] Element Access
+  /// Access the element in the front of the container.
+  reference front() { return at(0); }
+  /// Access the element in the front of the container.
+  const_reference front() const { return at(0); }
+  /// Access the element in the end of the container.
+  reference back() { return at(m_size - 1); }
+  /// Access the element in the end of the container.
+  const_reference back() const { return at(m_size - 1); }
+  /*!
+   * Access the element at the "pos" position in the container. ChunkSize is a
+   * power of two, so the division and the remainder are a shift and a mask.
+   */
+  reference at(size_type pos) {
+    return m_chunks[pos / ChunkSize][pos % ChunkSize];
+  }
+  /// Access the element at the "pos" position in the container.
+  const_reference at(size_type pos) const {
+    return m_chunks[pos / ChunkSize][pos % ChunkSize];
+  }
+  /// Access the element at the "pos" position in the container.
+  reference operator[](size_type pos) { return at(pos); }
+  /// Access the element at the "pos" position in the container.
+  const_reference operator[](size_type pos) const { return at(pos); }
+
+  //=== [III] Iterators
+  /*!
+   * Gets a iterator to the beginning of the container.
+   * \return iterator pointing to the beginning of the container.
+   */
+  iterator begin() { return iterator(this, 0); }
+  /// Gets a const_iterator to the beginning of the container.
+  const_iterator begin() const { return cbegin(); }
+  /// Gets a const_iterator to the beginning of the container.
+  const_iterator cbegin() const { return const_iterator(this, 0); }
+  /*!
+   * Gets a iterator to the element past the last element of  the container.
+   * \return iterator to the element past the last element of the container.
+   */
+  iterator end() { return iterator(this, m_size); }
+  /// Gets a const_iterator to the element past the last element.
+  const_iterator end() const { return cend(); }
+  /// Gets a const_iterator to the element past the last element.
+  const_iterator cend() const { return const_iterator(this, m_size); }
+  /// Gets a reverse_iterator to the last element of the container.
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  /// Gets a const_reverse_iterator to the last element of the container.
+  const_reverse_iterator rbegin() const { return crbegin(); }
+  /// Gets a const_reverse_iterator to the last element of the container.
+  const_reverse_iterator crbegin() const {
+    return const_reverse_iterator(cend());
+  }
+  /// Gets a reverse_iterator to the element before the first one.
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  /// Gets a const_reverse_iterator to the element before the first one.
+  const_reverse_iterator rend() const { return crend(); }
+  /// Gets a const_reverse_iterator to the element before the first one.
+  const_reverse_iterator crend() const {
+    return const_reverse_iterator(cbegin());
+  }
+
+  //=== [IV] Capacity
+  /// Consults whether the container is empty.
+  bool empty() const { return m_size == 0; }
+  /// Consults the number of elements in the container.
+  size_type size() const { return m_size; }
+  /// Consults the number of elements the allocated chunks can hold.
+  size_type capacity() const { return m_chunks.size() * ChunkSize; }
+  /// Consults the number of elements per chunk.
+  static constexpr size_type chunk_size() { return ChunkSize; }
+  /*!
+   * Allocates chunks until the container can hold "new_capacity" elements,
+   * so the insertions up to that take constant time. No element is moved.
+   * \param new_capacity capacity that the container should have.
+   */
+  void reserve(size_type new_capacity) {
+    size_type chunks = (new_capacity + ChunkSize - 1) / ChunkSize;
+    if (chunks > m_chunks.size()) {
+      m_chunks.reserve(chunks);
+      while (m_chunks.size() < chunks) {
+        add_chunk();
+      }
+    }
+  }
+  /// Deallocates the chunks that hold no element. No element is moved.
+  void shrink_to_fit() {
+    size_type used = (m_size + ChunkSize - 1) / ChunkSize;
+    for (size_type chunk{used}; chunk < m_chunks.size(); ++chunk) {
+      m_allocator.deallocate(m_chunks[chunk], ChunkSize);
+    }
+    m_chunks.resize(used);
+    m_chunks.shrink_to_fit();
+  }
+
+  //=== [V] Modifiers
+  /// Removes all elements of the container. The chunks are kept.
+  void clear() {
+    while (m_size > 0) {
+      pop_back();
+    }
+  }
+  /*!
+   * Constructs an element in place in the end of the container. No element is
+   * moved, even if a new chunk is needed.
+   * \param args arguments to forward to the constructor of the element.
+   * \return reference to the inserted element.
+   */
+  template <typename... Args> reference emplace_back(Args &&...args) {
+    if (m_size == capacity()) {
+      add_chunk();
+    }
+    pointer slot = &at(m_size);
+    ::new (slot) value_type(std::forward<Args>(args)...);
+    ++m_size;
+    return *slot;
+  }
+  /*!
+   * Inserts a element in the end of the container.
+   * \param value data to store.
+   */
+  void push_back(const_reference value) { emplace_back(value); }
+  /*!
+   * Inserts a element in the end of the container, moving it.
+   * \param value data to store.
+   */
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+  /// Removes the element in the end of the container.
+  void pop_back() {
+    --m_size;
+    at(m_size).~value_type();
+  }
+  /*!
+   * Changes the size of the container. If new_size > size, increases size
+   * of the container inserting copies of "value". If new_size < size, reduces
+   * the size of the container. Otherwise, do nothing.
+   * \param new_size new size of the container.
+   * \param value data to store in case on need. If not provided, default
+   *        constructor will be used.
+   */
+  void resize(size_type new_size, const_reference value = value_type()) {
+    reserve(new_size);
+    while (m_size < new_size) {
+      emplace_back(value);
+    }
+    while (m_size > new_size) {
+      pop_back();
+    }
+  }
+  /*!
+   * Exchanges the contents of this vector with the ones of "other", without
+   * copying nor moving any element.
+   * \param other vector to exchange contents with.
+   */
+  void swap(stable_vector &other) noexcept {
+    m_chunks.swap(other.m_chunks);
+    std::swap(m_size, other.m_size);
+  }
+
+private:
+  /*!
+   * Random access iterator of the stable_vector. It refers to the container
+   * and an index instead of to the element, so it remains valid when the
+   * container grows.
+   * \tparam Value type of the elements, const qualified for const_iterator.
+   */
+  template <typename Value> class StableVectorIterator {
+    using owner_type = std::conditional_t<std::is_const_v<Value>,
+                                          const stable_vector, stable_vector>;
+
+  public:
+    //=== Aliases.
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_const_t<Value>;
+    using pointer = Value *;
+    using reference = Value &;
+    using difference_type = std::ptrdiff_t;
+
+    /// Default constructor. Creates a iterator that points to nothing.
+    StableVectorIterator() = default;
+    /*!
+     * Constructs the iterator.
+     * \param owner container of the element.
+     * \param index position of the element in the container.
+     */
+    StableVectorIterator(owner_type *owner, size_type index)
+        : m_owner{owner}, m_index{static_cast<difference_type>(index)} {}
+    /// Converts a iterator into a const_iterator.
+    template <typename Other,
+              typename = std::enable_if_t<std::is_same_v<const Other, Value> &&
+                                          !std::is_same_v<Other, Value>>>
+    StableVectorIterator(const StableVectorIterator<Other> &other)
+        : m_owner{other.m_owner}, m_index{other.m_index} {}
+    /// Dereference operator.
+    reference operator*() const {
+      return m_owner->at(static_cast<size_type>(m_index));
+    }
+    /// Arrow operator.
+    pointer operator->() const { return &**this; }
+    /// Access the element "offset" positions away.
+    reference operator[](difference_type offset) const {
+      return m_owner->at(static_cast<size_type>(m_index + offset));
+    }
+    /// Pre-increment.
+    StableVectorIterator &operator++() {
+      ++m_index;
+      return *this;
+    }
+    /// Pos-increment.
+    StableVectorIterator operator++(int) {
+      StableVectorIterator copy{*this};
+      ++m_index;
+      return copy;
+    }
+    /// Pre-decrement.
+    StableVectorIterator &operator--() {
+      --m_index;
+      return *this;
+    }
+    /// Pos-decrement.
+    StableVectorIterator operator--(int) {
+      StableVectorIterator copy{*this};
+      --m_index;
+      return copy;
+    }
+    /// Advances the iterator "increment" positions.
+    StableVectorIterator &operator+=(difference_type increment) {
+      m_index += increment;
+      return *this;
+    }
+    /// Moves the iterator back "decrement" positions.
+    StableVectorIterator &operator-=(difference_type decrement) {
+      m_index -= decrement;
+      return *this;
+    }
+    /// Increment operator.
+    friend StableVectorIterator operator+(StableVectorIterator it,
+                                          difference_type increment) {
+      return it += increment;
+    }
+    /// Increment operator.
+    friend StableVectorIterator operator+(difference_type increment,
+                                          StableVectorIterator it) {
+      return it += increment;
+    }
+    /// Decrement operator.
+    friend StableVectorIterator operator-(StableVectorIterator it,
+                                          difference_type decrement) {
+      return it -= decrement;
+    }
+    /// Difference operator, the number of elements between two iterators.
+    friend difference_type operator-(const StableVectorIterator &left,
+                                     const StableVectorIterator &right) {
+      return left.m_index - right.m_index;
+    }
+    /// Checks whether two iterator are equal.
+    friend bool operator==(const StableVectorIterator &left,
+                           const StableVectorIterator &right) {
+      return left.m_owner == right.m_owner && left.m_index == right.m_index;
+    }
+    /// Checks whether two iterator are different.
+    friend bool operator!=(const StableVectorIterator &left,
+                           const StableVectorIterator &right) {
+      return !(left == right);
+    }
+    /// Checks whether "left" points before "right".
+    friend bool operator<(const StableVectorIterator &left,
+                          const StableVectorIterator &right) {
+      return left.m_index < right.m_index;
+    }
+    /// Checks whether "left" points after "right".
+    friend bool operator>(const StableVectorIterator &left,
+                          const StableVectorIterator &right) {
+      return right < left;
+    }
+    /// Checks whether "left" does not point after "right".
+    friend bool operator<=(const StableVectorIterator &left,
+                           const StableVectorIterator &right) {
+      return !(right < left);
+    }
+    /// Checks whether "left" does not point before "right".
+    friend bool operator>=(const StableVectorIterator &left,
+                           const StableVectorIterator &right) {
+      return !(left < right);
+    }
+
+  private:
+    template <typename> friend class StableVectorIterator;
+    owner_type *m_owner{nullptr}; //!< Container of the element.
+    difference_type m_index{0};   //!< Position of the element.
+  };
+
+  //=== Auxiliary Functions.
+  /// Allocates a chunk and appends it to the directory.
+  void add_chunk() {
+    pointer chunk = m_allocator.allocate(ChunkSize);
+    try {
+      m_chunks.push_back(chunk);
+    } catch (...) {
+      m_allocator.deallocate(chunk, ChunkSize);
+      throw;
+    }
+  }
+  /// Destroys the elements and deallocates all the chunks.
+  void release() {
+    clear();
+    for (pointer chunk : m_chunks) {
+      m_allocator.deallocate(chunk, ChunkSize);
+    }
+    m_chunks.clear();
+  }
+
+  vector<pointer> m_chunks;              //!< Directory of the chunks.
+  size_type m_size{0};                   //!< Number of elements.
+  std::allocator<value_type> m_allocator; //!< Allocates the chunks.
+};
+
+/// Exchanges the contents of two stable vectors.
+template <typename T, size_t ChunkSize>
+void swap(stable_vector<T, ChunkSize> &left,
+          stable_vector<T, ChunkSize> &right) noexcept {
+  left.swap(right);
+}
+} // namespace sc
+
+#endif // SRC_INCLUDE_VECTOR_STABLEVECTOR_H_
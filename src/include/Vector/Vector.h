@@ -1,23 +1,73 @@
 #ifndef SRC_INCLUDE_VECTOR_VECTOR_H_
 #define SRC_INCLUDE_VECTOR_VECTOR_H_
 
-#include <cstddef> // size_t, ptrdiff_t
+#include "ArrayOperations.h"
+#include <algorithm> // max
+#include <cstddef>   // size_t, ptrdiff_t
 #include <initializer_list>
-#include <iterator> // distance
+#include <iterator>        // distance
+#include <memory>          // allocator, allocator_traits
+#include <memory_resource> // polymorphic_allocator
+#include <type_traits>     // enable_if, is_integral, is_same, remove_const
+#include <utility>         // move, forward, swap
 
 // Namespace for sequential containers(sc).
 namespace sc {
+/*
+ * Growth policies of the vector. Each one is a functor that receives the
+ * current capacity and the capacity required by an insertion, and returns the
+ * capacity to grow to, which must not be less than the required one.
+ */
+namespace growth {
+/// Doubles the capacity.
+template <class T> struct Double {
+  size_t operator()(size_t capacity, size_t required) const {
+    return std::max({required, 2 * capacity, size_t{1}});
+  }
+};
+/// Increases the capacity by half, trading reallocations for less memory.
+template <class T> struct OneAndHalf {
+  size_t operator()(size_t capacity, size_t required) const {
+    return std::max({required, capacity + capacity / 2, size_t{1}});
+  }
+};
+/*!
+ * Doubles the capacity and, once the buffer is bigger than a page, rounds it up
+ * to a whole number of pages, so no memory of the last page is wasted.
+ * \tparam PageSize size of a memory page in bytes.
+ */
+template <class T, size_t PageSize = 4096> struct PageAligned {
+  size_t operator()(size_t capacity, size_t required) const {
+    size_t bytes = Double<T>{}(capacity, required) * sizeof(T);
+    if (bytes > PageSize) {
+      bytes = (bytes + PageSize - 1) / PageSize * PageSize;
+    }
+    return bytes / sizeof(T);
+  }
+};
+} // namespace growth
+
 /*!
  * Dynamic size arrays, a.k.a. vector. Stores elements sequentially in the
  * memory, allowing quick retrieval and storage of values.
  * \tparam T data type to store.
+ * \tparam GrowthPolicy functor that decides the new capacity when an insertion
+ *         does not fit, see namespace growth. Default = growth::Double.
+ * \tparam Allocator allocator used to acquire the memory and to construct and
+ *         destroy the elements, e.g. std::pmr::polymorphic_allocator to place
+ *         the vector in an arena. Its pointer type must be a raw pointer.
+ *         Default = std::allocator.
  *
  * \author Eduardo Marinho (eduardo.nestor.marinho228@gmail.com)
  */
-template <typename T> class vector {
+template <typename T, class GrowthPolicy = growth::Double<T>,
+          class Allocator = std::allocator<T>>
+class vector {
+  using alloc_traits = std::allocator_traits<Allocator>;
+
 public:
   // Forward declaration.
-  class iterator;
+  template <typename Value> class VectorIterator;
   //=== Aliases.
   using value_type = T;
   using pointer = value_type *;
@@ -26,51 +76,100 @@ public:
   using const_reference = const value_type &;
   using size_type = size_t;
   using difference_type = std::ptrdiff_t;
+  using allocator_type = Allocator;
+  using iterator = VectorIterator<value_type>;
+  using const_iterator = VectorIterator<const value_type>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
   //=== [I] Special Functions
+  /// Default constructor. Creates an empty vector.
+  vector() = default;
+  /// Creates an empty vector that uses "alloc" to acquire memory.
+  explicit vector(const allocator_type &alloc) : m_allocator{alloc} {}
   /*!
-   * Default constructor. Creates a vector with "count" copies of "value".
-   * In case no parameters are provided, the vector will be created empty.
+   * Creates a vector with "count" copies of "value".
    * \param count number of elements to insert.
-   * \param value data to store in the vector.
+   * \param value data to store in the vector. If not provided, default
+   *        constructor will be used.
+   * \param alloc allocator to acquire memory with.
    */
-  explicit vector(size_type count = 0, value_type value = T()) {
+  explicit vector(size_type count, const_reference value = T(),
+                  const allocator_type &alloc = allocator_type())
+      : m_allocator{alloc} {
     if (count > 0) {
-      m_size = count;
+      m_array = allocate(count);
       m_capacity = count;
-      m_array = new T[m_size];
-      for (size_type index{0}; index < m_size; ++index) {
-        m_array[index] = value;
-      }
+      detail::construct_fill(m_allocator, m_array, count, value);
+      m_size = count;
     }
   }
   /*!
    * Creates a vector with the same size and the same elements as the ilist.
    * \param ilist initializer_list with elements to insert in the vector.
+   * \param alloc allocator to acquire memory with.
    */
-  vector(std::initializer_list<value_type> ilist) {
+  vector(std::initializer_list<value_type> ilist,
+         const allocator_type &alloc = allocator_type())
+      : m_allocator{alloc} {
     reserve(ilist.size());
     for (auto it = ilist.begin(); it != ilist.end(); ++it) {
       push_back(*it);
     }
   }
   /*!
-   * Copy constructor. Creates a vector equivalent to "copy".
+   * Copy constructor. Creates a vector equivalent to "copy", with the allocator
+   * the allocator of "copy" selects for copies.
+   * \param copy vector to be copied.
+   */
+  vector(const vector &copy)
+      : vector(copy, alloc_traits::select_on_container_copy_construction(
+                         copy.m_allocator)) {}
+  /*!
+   * Creates a vector equivalent to "copy" that uses "alloc" to acquire memory.
    * \param copy vector to be copied.
+   * \param alloc allocator to acquire memory with.
    */
-  vector(const vector &copy) {
+  vector(const vector &copy, const allocator_type &alloc) : m_allocator{alloc} {
     reserve(copy.m_capacity);
+    detail::construct_copy(m_allocator, copy.m_array,
+                           copy.m_array + copy.m_size, m_array);
     m_size = copy.m_size;
-    for (size_type index{0}; index < m_size; ++index) {
-      m_array[index] = copy.m_array[index];
+  }
+  /*!
+   * Creates a vector with the elements of "other" that uses "alloc" to acquire
+   * memory. If "alloc" is equal to the allocator of "other", the buffer of
+   * "other" is taken over, otherwise the elements are moved one by one to a
+   * buffer allocated with "alloc", e.g. out of an arena. "other" is left empty.
+   * \param other vector to take the elements from.
+   * \param alloc allocator to acquire memory with.
+   */
+  vector(vector &&other, const allocator_type &alloc) : m_allocator{alloc} {
+    if (m_allocator == other.m_allocator) {
+      steal(other);
+    } else {
+      move_elements(other);
     }
   }
+  /*!
+   * Move constructor. Takes over the buffer and the allocator of "other", so no
+   * element is copied nor moved. "other" is left empty.
+   * \param other vector to take the buffer from.
+   */
+  vector(vector &&other) noexcept : m_allocator{std::move(other.m_allocator)} {
+    steal(other);
+  }
   /*!
    * Creates a vector with the data in the range [begin, end).
    * \param begin beginning of the range.
    * \param end ending of the range (not included).
+   * \param alloc allocator to acquire memory with.
    */
-  template <typename InputIt> vector(InputIt begin, InputIt end) {
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  vector(InputIt begin, InputIt end,
+         const allocator_type &alloc = allocator_type())
+      : m_allocator{alloc} {
     assign(begin, end);
   }
   /*!
@@ -78,11 +177,12 @@ public:
    * \param begin beginning of the range.
    * \param end ending of the range (not included).
    */
-  template <typename InputIt> void assign(InputIt begin, InputIt end) {
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  void assign(InputIt begin, InputIt end) {
     clear();
     reserve(std::distance(begin, end));
-    for (size_type index{0}; begin != end; ++begin, ++index) {
-      // m_array[index] = *begin;
+    for (; begin != end; ++begin) {
       push_back(*begin);
     }
   }
@@ -101,16 +201,60 @@ public:
    * Makes the vector equal to the ilist.
    * \param ilist initializer_list with elements to insert in the vector.
    */
-  vector operator=(std::initializer_list<value_type> ilist) {
+  vector &operator=(std::initializer_list<value_type> ilist) {
     assign(ilist);
     return *this;
   }
-  /// Deallocates memory.
-  ~vector() {
-    if (m_array != nullptr) {
-      delete[] m_array;
+  /*!
+   * Makes this vector be equivalent to "copy". The current buffer is reused
+   * when it is big enough.
+   * \param copy vector to be copied.
+   */
+  vector &operator=(const vector &copy) {
+    if (this != &copy) {
+      if constexpr (
+          alloc_traits::propagate_on_container_copy_assignment::value) {
+        if (m_allocator != copy.m_allocator) {
+          release();
+        }
+        m_allocator = copy.m_allocator;
+      }
+      assign(copy.m_array, copy.m_array + copy.m_size);
     }
+    return *this;
+  }
+  /*!
+   * Makes this vector take the elements of "other", which is left empty. The
+   * buffer of "other" is taken over, unless the allocators differ and do not
+   * propagate, in which case the elements are moved one by one.
+   * \param other vector to take the elements from.
+   */
+  vector &operator=(vector &&other) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value) {
+    if (this == &other) {
+      return *this;
+    }
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+      release();
+      m_allocator = std::move(other.m_allocator);
+      steal(other);
+    } else if (m_allocator == other.m_allocator) {
+      release();
+      steal(other);
+    } else {
+      clear();
+      move_elements(other);
+    }
+    return *this;
   }
+  /// Destroys the elements and deallocates memory.
+  ~vector() {
+    clear();
+    deallocate(m_array, m_capacity);
+  }
+  /// Consults the allocator associated with the container.
+  allocator_type get_allocator() const { return m_allocator; }
 
   //=== [II] Element Access
   /// Access the element in the front of the container.
@@ -140,11 +284,35 @@ public:
    * \return iterator pointing to the beginning of the container.
    */
   iterator begin() { return iterator(m_array); }
+  /// Gets a const_iterator to the beginning of the container.
+  const_iterator begin() const { return cbegin(); }
+  /// Gets a const_iterator to the beginning of the container.
+  const_iterator cbegin() const { return const_iterator(m_array); }
   /*!
    * Gets a iterator to the element past the last element of  the container.
    * \return iterator to the element past the last element of the container.
    */
   iterator end() { return iterator(m_array + m_size); }
+  /// Gets a const_iterator to the element past the last element.
+  const_iterator end() const { return cend(); }
+  /// Gets a const_iterator to the element past the last element.
+  const_iterator cend() const { return const_iterator(m_array + m_size); }
+  /// Gets a reverse_iterator to the last element of the container.
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  /// Gets a const_reverse_iterator to the last element of the container.
+  const_reverse_iterator rbegin() const { return crbegin(); }
+  /// Gets a const_reverse_iterator to the last element of the container.
+  const_reverse_iterator crbegin() const {
+    return const_reverse_iterator(cend());
+  }
+  /// Gets a reverse_iterator to the element before the first one.
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  /// Gets a const_reverse_iterator to the element before the first one.
+  const_reverse_iterator rend() const { return crend(); }
+  /// Gets a const_reverse_iterator to the element before the first one.
+  const_reverse_iterator crend() const {
+    return const_reverse_iterator(cbegin());
+  }
 
   //=== [IV] Capacity
   /// Consults whether the container is empty.
@@ -158,15 +326,7 @@ public:
    */
   void reserve(size_type new_capacity) {
     if (new_capacity > m_capacity) {
-      pointer tmp = new value_type[new_capacity];
-      m_capacity = new_capacity;
-      for (size_type index{0}; index < m_size; ++index) {
-        tmp[index] = m_array[index];
-      }
-      if (m_array != nullptr) {
-        delete[] m_array;
-      }
-      m_array = tmp;
+      reallocate(new_capacity);
     }
   }
   /// Consults the capacity of the container.
@@ -178,94 +338,76 @@ public:
    */
   void shrink_to_fit() {
     if (m_capacity > m_size) {
-      pointer tmp = new value_type[m_size];
-      for (size_type index{0}; index < m_size; ++index) {
-        tmp[index] = m_array[m_size];
-      }
-      delete[] m_array;
-      m_capacity = m_size;
-      m_array = tmp;
+      reallocate(m_size);
     }
   }
 
   //=== [V] Modifiers
   /// Removes all elements of the container, i.e. empties it.
-  void clear() { m_size = 0; }
+  void clear() {
+    detail::destroy(m_allocator, m_array, m_array + m_size);
+    m_size = 0;
+  }
   /*!
    * Inserts the data "value" before the position pointed by "pos".
    * \param pos iterator pointing to the element past the position to insert.
    * \param value data to insert.
    * \return iterator pointing to the inserted value.
    */
-  iterator insert(iterator pos, const_reference value) {
-    size_type pos_index = std::distance(m_array, &pos);
-    if (m_capacity == 0) {
-      reserve(1);
-    } else if (m_size == m_capacity) {
-      reserve(2 * m_size);
-    }
-    pos = iterator(m_array + pos_index);
-    for (iterator it_first = pos, it_last = end(); it_first != end();
-         ++it_first, --it_last) {
-      *it_last = *it_first;
-    }
-    *pos = value;
-    ++m_size;
-    return pos;
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+  /*!
+   * Inserts the data "value" before the position pointed by "pos", moving it
+   * into the container.
+   * \param pos iterator pointing to the element past the position to insert.
+   * \param value data to insert.
+   * \return iterator pointing to the inserted value.
+   */
+  iterator insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
   }
   /*!
    * Inserts "count" copies of "value" before position pointed by "pos".
-   * Note: be careful to avoid ambiguity with the range insert function.
    * \param pos iterator pointing to the element past the position to insert.
    * \param count number of copies to insert.
    * \param value data to insert.
    * \return iterator pointing to the first element inserted, or "pos" if
    *         "count" == 0.
    */
-  iterator insert(iterator pos, size_type count, const_reference value) {
-    size_type pos_index = std::distance(m_array, &pos);
+  iterator insert(const_iterator pos, size_type count, const_reference value) {
+    size_type pos_index = pos - cbegin();
+    // "value" may be an element, which the reallocation or the gap would move.
+    value_type copy(value);
     if (m_capacity < m_size + count) {
-      reserve(m_size + count);
+      reserve(next_capacity(m_size + count));
     }
-    pos = iterator(m_array + pos_index);
-
-    for (iterator it_origin = end() - 1, it_destiny = end() + count - 1;
-         it_origin != pos - 1; --it_origin, --it_destiny) {
-      *it_destiny = *it_origin;
-    }
-    for (auto runner = pos; runner != pos + count; ++runner) {
-      *runner = value;
-    }
-    m_size += count;
-    return pos;
+    detail::insert_gap(m_allocator, m_array, m_size, pos_index, count,
+                       [&](pointer gap) {
+                         detail::construct_fill(m_allocator, gap, count, copy);
+                       });
+    return iterator(m_array + pos_index);
   }
   /*!
    * Inserts elements in range [first, last) before position pointed by "pos".
-   * Note: be careful to avoid ambiguity with the copy insert function.
    * \param first beginning of the range of elements.
    * \param last end of the range of elements.
    * \return iterator pointing to the first element inserted, or "pos" if
    * "first" == "last".
    */
-  template <class InputIt>
-  iterator insert(iterator pos, InputIt first, InputIt last) {
-    size_type pos_index = std::distance(m_array, &pos);
+  template <class InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type pos_index = pos - cbegin();
     size_type number_elements = std::distance(first, last);
     if (m_capacity < m_size + number_elements) {
-      reserve(m_size + number_elements);
-    }
-    pos = iterator(m_array + pos_index);
-
-    for (iterator it_origin = end() - 1,
-                  it_destiny = end() + number_elements - 1;
-         it_origin != pos - 1; --it_origin, --it_destiny) {
-      *it_destiny = *it_origin;
+      reserve(next_capacity(m_size + number_elements));
     }
-    for (iterator runner = pos; first != last; ++runner, ++first) {
-      *runner = *first;
-    }
-    m_size += number_elements;
-    return pos;
+    detail::insert_gap(m_allocator, m_array, m_size, pos_index, number_elements,
+                       [&](pointer gap) {
+                         detail::construct_copy(m_allocator, first, last, gap);
+                       });
+    return iterator(m_array + pos_index);
   }
   /*!
    * Inserts elements from "ilist" before position pointed by "pos".
@@ -274,23 +416,17 @@ public:
    * \return iterator pointing to first element inserted, or "pos" if "ilist" is
    *         empty.
    */
-  iterator insert(iterator pos, std::initializer_list<T> ilist) {
-    size_type pos_index = std::distance(m_array, &pos);
+  iterator insert(const_iterator pos, std::initializer_list<T> ilist) {
+    size_type pos_index = pos - cbegin();
     if (m_capacity < m_size + ilist.size()) {
-      reserve(m_size + ilist.size());
-    }
-    pos = iterator(m_array + pos_index);
-
-    for (iterator it_origin = end() - 1, it_destiny = end() + ilist.size() - 1;
-         it_origin != pos - 1; --it_origin, --it_destiny) {
-      *it_destiny = *it_origin;
-    }
-    for (auto ilist_runner = ilist.begin(); ilist_runner != ilist.end();
-         ++ilist_runner, ++pos) {
-      *pos = *ilist_runner;
-    }
-    m_size += ilist.size();
-    return pos - ilist.size();
+      reserve(next_capacity(m_size + ilist.size()));
+    }
+    detail::insert_gap(m_allocator, m_array, m_size, pos_index, ilist.size(),
+                       [&](pointer gap) {
+                         detail::construct_copy(m_allocator, ilist.begin(),
+                                                ilist.end(), gap);
+                       });
+    return iterator(m_array + pos_index);
   }
   /*!
    * Removes the element pointed by "pos".
@@ -298,12 +434,10 @@ public:
    * \return iterator pointing to the element past the removed one. Note, that
    *         it can return end().
    */
-  iterator erase(iterator pos) {
-    for (iterator it = pos + 1; it != end(); ++it) {
-      *(it - 1) = *it;
-    }
-    --m_size;
-    return pos;
+  iterator erase(const_iterator pos) {
+    size_type pos_index = pos - cbegin();
+    detail::close_gap(m_allocator, m_array, m_size, pos_index, 1);
+    return iterator(m_array + pos_index);
   }
   /*!
    * Removes the range of elements ["first", "last").
@@ -312,13 +446,10 @@ public:
    * \return iterator pointing to the element past the removed one. Note, that
    *         it can return end().
    */
-  iterator erase(iterator first, iterator last) {
-    for (auto copy_it = last + 1, erase_it = first; erase_it != last;
-         ++erase_it, ++copy_it) {
-      *erase_it = *copy_it;
-    }
-    m_size -= last - first;
-    return iterator(first);
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type first_index = first - cbegin();
+    detail::close_gap(m_allocator, m_array, m_size, first_index, last - first);
+    return iterator(m_array + first_index);
   }
   /*!
    * Changes the size of the container. If new_size > size, increases size
@@ -328,122 +459,357 @@ public:
    * \param value data to store in case on need. If not provided, default
    *        constructor will be used.
    */
-  void resize(size_type new_size, value_type value = value_type()) {
-    if (new_size > m_capacity) {
-      reserve(new_size);
-      for (size_type index{m_size}; index < new_size; ++index) {
-        m_array[index] = value_type();
+  void resize(size_type new_size, const_reference value = value_type()) {
+    if (new_size > m_size) {
+      if (new_size > m_capacity) {
+        // "value" may be an element, so it is copied before the reallocation.
+        value_type copy(value);
+        reserve(next_capacity(new_size));
+        detail::construct_fill(m_allocator, m_array + m_size,
+                               new_size - m_size, copy);
+      } else {
+        detail::construct_fill(m_allocator, m_array + m_size,
+                               new_size - m_size, value);
       }
+    } else {
+      detail::destroy(m_allocator, m_array + new_size, m_array + m_size);
     }
     m_size = new_size;
   }
+  /*!
+   * Constructs an element in place before the position pointed by "pos".
+   * \param pos iterator pointing to the element past the position to insert.
+   * \param args arguments to forward to the constructor of the element.
+   * \return iterator pointing to the inserted element.
+   */
+  template <typename... Args> iterator emplace(const_iterator pos,
+                                              Args &&...args) {
+    size_type pos_index = pos - cbegin();
+    if (pos_index == m_size) {
+      emplace_back(std::forward<Args>(args)...);
+    } else {
+      // The arguments may refer to elements of the container, which are
+      // about to be moved, so the new element is built before that.
+      value_type tmp(std::forward<Args>(args)...);
+      if (m_size == m_capacity) {
+        reserve(next_capacity(m_size + 1));
+      }
+      detail::insert_gap(m_allocator, m_array, m_size, pos_index, 1,
+                         [&](pointer gap) { construct(gap, std::move(tmp)); });
+    }
+    return iterator(m_array + pos_index);
+  }
+  /*!
+   * Constructs an element in place in the end of the container.
+   * \param args arguments to forward to the constructor of the element.
+   * \return reference to the inserted element.
+   */
+  template <typename... Args> reference emplace_back(Args &&...args) {
+    if (m_size == m_capacity) {
+      return grow_and_emplace_back(std::forward<Args>(args)...);
+    }
+    construct(m_array + m_size, std::forward<Args>(args)...);
+    return m_array[m_size++];
+  }
   /*!
    * Inserts a element in the end of the container.
    * \param value data to store.
    */
-  void push_back(value_type value) { insert(end(), value); }
+  void push_back(const_reference value) { emplace_back(value); }
+  /*!
+   * Inserts a element in the end of the container, moving it.
+   * \param value data to store.
+   */
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+  /// Removes the element in the end of the container, which must not be empty.
+  void pop_back() {
+    --m_size;
+    detail::destroy(m_allocator, m_array + m_size, m_array + m_size + 1);
+  }
+  /*!
+   * Inserts "count" elements in the end of the container, built directly in
+   * its uninitialized storage by "construct", e.g. from several threads at
+   * once, see ParallelAlgorithms.h. The elements are not constructed through
+   * the allocator.
+   * \param count number of elements to insert.
+   * \param construct function that receives a pointer to the storage of the
+   *        new elements and must construct all of them. If it throws, it must
+   *        not leave any of them constructed, the size is not changed then.
+   */
+  template <typename Construct>
+  void append_uninitialized(size_type count, Construct construct) {
+    if (m_size + count > m_capacity) {
+      reserve(next_capacity(m_size + count));
+    }
+    construct(m_array + m_size);
+    m_size += count;
+  }
+  /*!
+   * Exchanges the contents of this vector with the ones of "other", without
+   * copying nor moving any element. The allocators are only exchanged if they
+   * propagate on swap, otherwise they must be equal.
+   * \param other vector to exchange contents with.
+   */
+  void swap(vector &other) noexcept {
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      std::swap(m_allocator, other.m_allocator);
+    }
+    std::swap(m_array, other.m_array);
+    std::swap(m_size, other.m_size);
+    std::swap(m_capacity, other.m_capacity);
+  }
   /*!
    * Inserts a element in the beginning of the container.
    * \param value data to store.
    */
-  void push_front(value_type value) { insert(begin(), value); }
+  void push_front(const_reference value) { emplace(begin(), value); }
+  /*!
+   * Inserts a element in the beginning of the container, moving it.
+   * \param value data to store.
+   */
+  void push_front(value_type &&value) { emplace(begin(), std::move(value)); }
 
-  class iterator {
+  /*!
+   * Contiguous iterator of the vector, which satisfies the random access
+   * iterator requirements, so std algorithms can work on it as on a pointer.
+   * \tparam Value type of the elements, const qualified for const_iterator.
+   */
+  template <typename Value> class VectorIterator {
   public:
     //=== Aliases.
-    using value_type = T;
-    using pointer = value_type *;
-    using const_pointer = const value_type *;
-    using reference = value_type &;
-    using const_reference = const value_type &;
-    using size_type = size_t;
+    using iterator_category = std::random_access_iterator_tag;
+#if __cplusplus > 201703L
+    using iterator_concept = std::contiguous_iterator_tag;
+#endif
+    using value_type = std::remove_const_t<Value>;
+    using pointer = Value *;
+    using reference = Value &;
     using difference_type = std::ptrdiff_t;
 
-    // Deleting default constructor.
-    iterator() = delete;
+    /// Default constructor. Creates a iterator that points to nothing.
+    VectorIterator() = default;
     /*!
      * Constructs the iterator.
-     * \param pointer to a value in the container.
+     * \param ptr pointer to a value in the container.
      */
-    explicit iterator(pointer ptr) { this->m_pointer = ptr; }
-    /// Default copy constructor.
-    iterator(const iterator &copy) = default;
-    /// Default destructor.
-    ~iterator() = default;
+    explicit VectorIterator(pointer ptr) : m_pointer{ptr} {}
+    /// Converts a iterator into a const_iterator.
+    template <typename Other,
+              typename = std::enable_if_t<std::is_same_v<const Other, Value> &&
+                                          !std::is_same_v<Other, Value>>>
+    VectorIterator(const VectorIterator<Other> &other)
+        : m_pointer{other.m_pointer} {}
     /// Dereference operator.
-    reference operator*() { return *m_pointer; }
-    /// Constant dereference operator.
-    const_reference operator*() const { return *m_pointer; }
-    /// Consults the underlying pointer of the iterator.
-    pointer operator&() { return m_pointer; }
-    /// Consults the underlying pointer of the iterator.
-    const_pointer operator&() const { return m_pointer; }
+    reference operator*() const { return *m_pointer; }
     /// Arrow operator.
     pointer operator->() const { return m_pointer; }
+    /// Access the element "offset" positions away.
+    reference operator[](difference_type offset) const {
+      return m_pointer[offset];
+    }
     /// Pre-increment.
-    iterator operator++() {
+    VectorIterator &operator++() {
       ++m_pointer;
-      return iterator(m_pointer);
+      return *this;
     }
     /// Pos-increment.
-    iterator operator++(int) {
-      pointer copy = m_pointer;
-      ++m_pointer;
-      return iterator(copy);
-    }
-    /// Increment operator.
-    friend iterator operator+(iterator it, difference_type increment) {
-      return iterator(&it + increment);
-    }
-    /// Increment operator.
-    friend iterator operator+(difference_type increment, iterator it) {
-      return iterator(&it + increment);
-    }
+    VectorIterator operator++(int) { return VectorIterator(m_pointer++); }
     /// Pre-decrement.
-    iterator operator--() {
+    VectorIterator &operator--() {
       --m_pointer;
-      return iterator(m_pointer);
+      return *this;
     }
     /// Pos-decrement.
-    iterator operator--(int) {
-      pointer copy = m_pointer;
-      --m_pointer;
-      return iterator(copy);
+    VectorIterator operator--(int) { return VectorIterator(m_pointer--); }
+    /// Advances the iterator "increment" positions.
+    VectorIterator &operator+=(difference_type increment) {
+      m_pointer += increment;
+      return *this;
+    }
+    /// Moves the iterator back "decrement" positions.
+    VectorIterator &operator-=(difference_type decrement) {
+      m_pointer -= decrement;
+      return *this;
+    }
+    /// Increment operator.
+    friend VectorIterator operator+(VectorIterator it,
+                                    difference_type increment) {
+      return it += increment;
+    }
+    /// Increment operator.
+    friend VectorIterator operator+(difference_type increment,
+                                    VectorIterator it) {
+      return it += increment;
     }
     /// Decrement operator.
-    friend iterator operator-(iterator it, difference_type decrement) {
-      return iterator(&it - decrement);
+    friend VectorIterator operator-(VectorIterator it,
+                                    difference_type decrement) {
+      return it -= decrement;
     }
-    /// Difference operator.
-    friend size_type operator-(iterator left, iterator right) {
+    /// Difference operator, the number of elements between two iterators.
+    friend difference_type operator-(const VectorIterator &left,
+                                     const VectorIterator &right) {
       return left.m_pointer - right.m_pointer;
     }
-    /*!
-     * Makes this be equal to the iterator "copy".
-     * \param copy iterator to copy the data from.
-     */
-    iterator operator=(const iterator &copy) {
-      m_pointer = copy.m_pointer;
-      return copy;
+    /// Checks whether two iterator are equal.
+    friend bool operator==(const VectorIterator &left,
+                           const VectorIterator &right) {
+      return left.m_pointer == right.m_pointer;
     }
     /// Checks whether two iterator are different.
-    bool operator!=(const iterator &right) {
-      return m_pointer != right.m_pointer;
-    }
-    /// Checks whether two iterator are equal.
-    bool operator==(const iterator &right) {
-      return m_pointer == right.m_pointer;
+    friend bool operator!=(const VectorIterator &left,
+                           const VectorIterator &right) {
+      return left.m_pointer != right.m_pointer;
+    }
+    /// Checks whether "left" points before "right".
+    friend bool operator<(const VectorIterator &left,
+                          const VectorIterator &right) {
+      return left.m_pointer < right.m_pointer;
+    }
+    /// Checks whether "left" points after "right".
+    friend bool operator>(const VectorIterator &left,
+                          const VectorIterator &right) {
+      return right < left;
+    }
+    /// Checks whether "left" does not point after "right".
+    friend bool operator<=(const VectorIterator &left,
+                           const VectorIterator &right) {
+      return !(right < left);
+    }
+    /// Checks whether "left" does not point before "right".
+    friend bool operator>=(const VectorIterator &left,
+                           const VectorIterator &right) {
+      return !(left < right);
     }
 
   private:
-    pointer m_pointer; //!< Pointer to a element in the container.
+    template <typename> friend class VectorIterator;
+    pointer m_pointer{nullptr}; //!< Pointer to a element in the container.
   };
 
 private:
-  pointer m_array{nullptr}; //!< Pointer to the beginning of the container.
-  size_type m_size{0};      //!< Number of elements in the container.
-  size_type m_capacity{0};  //!< Capacity of the container.
+  //=== Auxiliary Functions.
+  /// Allocates uninitialized memory for "count" elements with the allocator.
+  pointer allocate(size_type count) {
+    return alloc_traits::allocate(m_allocator, count);
+  }
+  /*!
+   * Deallocates memory obtained with allocate(). Does not destroy elements.
+   * \param array memory to deallocate, may be null.
+   * \param count number of elements the memory was allocated for.
+   */
+  void deallocate(pointer array, size_type count) {
+    if (array != nullptr) {
+      alloc_traits::deallocate(m_allocator, array, count);
+    }
+  }
+  /// Constructs an element at "location" with the allocator.
+  template <typename... Args> void construct(pointer location, Args &&...args) {
+    alloc_traits::construct(m_allocator, location, std::forward<Args>(args)...);
+  }
+  /// Destroys the elements and deallocates the buffer, leaving no capacity.
+  void release() {
+    clear();
+    deallocate(m_array, m_capacity);
+    m_array = nullptr;
+    m_capacity = 0;
+  }
+  /*!
+   * Takes over the buffer of "other", which is left empty. This vector must
+   * not have a buffer, and its allocator must be able to deallocate the one
+   * of "other".
+   * \param other vector to take the buffer from.
+   */
+  void steal(vector &other) {
+    std::swap(m_array, other.m_array);
+    std::swap(m_size, other.m_size);
+    std::swap(m_capacity, other.m_capacity);
+  }
+  /*!
+   * Moves the elements of "other" one by one to the buffer of this vector,
+   * which must be empty. "other" is left empty, but keeps its buffer.
+   * \param other vector to take the elements from.
+   */
+  void move_elements(vector &other) {
+    reserve(other.m_size);
+    detail::relocate(m_allocator, other.m_array,
+                     other.m_array + other.m_size, m_array);
+    m_size = other.m_size;
+    other.m_size = 0;
+  }
+  /*!
+   * Moves the elements to a new buffer with capacity for "new_capacity"
+   * elements, which must not be less than the size.
+   * \param new_capacity capacity of the new buffer.
+   */
+  void reallocate(size_type new_capacity) {
+    pointer tmp = new_capacity > 0 ? allocate(new_capacity) : nullptr;
+    try {
+      detail::relocate(m_allocator, m_array, m_array + m_size, tmp);
+    } catch (...) {
+      deallocate(tmp, new_capacity);
+      throw;
+    }
+    deallocate(m_array, m_capacity);
+    m_array = tmp;
+    m_capacity = new_capacity;
+  }
+  /*!
+   * Consults the capacity to grow to, according to the growth policy.
+   * \param required minimum capacity needed by the insertion.
+   * \return new capacity, not less than "required".
+   */
+  size_type next_capacity(size_type required) const {
+    return GrowthPolicy{}(m_capacity, required);
+  }
+  /*!
+   * Moves the elements to a bigger buffer, constructing a new element in its
+   * end. The new element is constructed before the others are moved, because
+   * the arguments may refer to them.
+   * \param args arguments to forward to the constructor of the element.
+   * \return reference to the inserted element.
+   */
+  template <typename... Args>
+  reference grow_and_emplace_back(Args &&...args) {
+    size_type new_capacity = next_capacity(m_size + 1);
+    pointer tmp = allocate(new_capacity);
+    try {
+      construct(tmp + m_size, std::forward<Args>(args)...);
+    } catch (...) {
+      deallocate(tmp, new_capacity);
+      throw;
+    }
+    try {
+      detail::relocate(m_allocator, m_array, m_array + m_size, tmp);
+    } catch (...) {
+      detail::destroy(m_allocator, tmp + m_size, tmp + m_size + 1);
+      deallocate(tmp, new_capacity);
+      throw;
+    }
+    deallocate(m_array, m_capacity);
+    m_array = tmp;
+    m_capacity = new_capacity;
+    return m_array[m_size++];
+  }
+
+  pointer m_array{nullptr};     //!< Pointer to the beginning of the container.
+  size_type m_size{0};          //!< Number of elements in the container.
+  size_type m_capacity{0};      //!< Capacity of the container.
+  allocator_type m_allocator{}; //!< Allocator that owns the memory.
 };
+
+/// Exchanges the contents of "lhs" and "rhs", see vector::swap().
+template <typename T, class GrowthPolicy, class Allocator>
+void swap(vector<T, GrowthPolicy, Allocator> &lhs,
+          vector<T, GrowthPolicy, Allocator> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+// Vectors that acquire memory from a std::pmr::memory_resource.
+namespace pmr {
+template <typename T, class GrowthPolicy = growth::Double<T>>
+using vector = sc::vector<T, GrowthPolicy, std::pmr::polymorphic_allocator<T>>;
+} // namespace pmr
 } // namespace sc
 
 #endif // SRC_INCLUDE_VECTOR_VECTOR_H_
@@ -0,0 +1,25 @@
+#ifndef SRC_TEST_ADAPTER_MINIMALDEQUE_H_
+#define SRC_TEST_ADAPTER_MINIMALDEQUE_H_
+
+#include <cstddef> // size_t
+#include <deque>
+
+/*!
+ * Container with only what sc::queue and sc::stack need, without range insert
+ * nor erase, so their batch functions go element by element.
+ */
+template <typename T> class minimal_deque {
+public:
+  using value_type = T;
+  T &front() { return m_data.front(); }
+  T &back() { return m_data.back(); }
+  size_t size() const { return m_data.size(); }
+  void push_back(const T &value) { m_data.push_back(value); }
+  void pop_front() { m_data.pop_front(); }
+  void pop_back() { m_data.pop_back(); }
+
+private:
+  std::deque<T> m_data;
+};
+
+#endif // SRC_TEST_ADAPTER_MINIMALDEQUE_H_
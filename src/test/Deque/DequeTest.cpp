@@ -1,7 +1,13 @@
 #include "Deque/Deque.h"
 #include "gtest/gtest.h"
+#include <algorithm>
 #include <deque>
+#include <memory>
+#include <set>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 /*
  * The "lib" macro can be used to select which lib to test. To ensure the
@@ -10,7 +16,10 @@
  * test changing the size of the deque's block, the "sc" namespace is used
  * directly since the "std" library is not compatible with that, also the tests
  * for the "InsertCopy" function uses the namespace "sc" directly, since the
- * functions signatures are different.
+ * functions signatures are different, and so does the test of the noexcept
+ * move, which "std" does not guarantee. The results of "insert" and "erase" are
+ * stored before being compared with "begin" or "end", since the order in which
+ * the arguments of EXPECT_EQ are evaluated is unspecified.
  */
 #define lib sc
 // #define lib std
@@ -147,6 +156,45 @@ TEST(SpecialFunctions, MoveConstructor) {
   }
 }
 
+TEST(SpecialFunctions, NothrowMove) {
+  static_assert(std::is_nothrow_move_constructible_v<sc::deque<std::string>>);
+  static_assert(std::is_nothrow_move_assignable_v<sc::deque<std::string>>);
+  // A vector of deques moves them when it grows, so the elements stay put.
+  std::vector<sc::deque<std::string>> deques(1);
+  deques[0].push_back("first");
+  const std::string *first = &deques[0].front();
+  for (size_t counter{0}; counter < 100; ++counter) {
+    deques.emplace_back();
+  }
+  EXPECT_EQ(&deques[0].front(), first);
+}
+
+TEST(SpecialFunctions, MovedFromIsUsable) {
+  lib::deque<std::string> deque1{"a", "b", "c"};
+  lib::deque<std::string> deque2(std::move(deque1));
+  deque1.clear();
+  deque1.shrink_to_fit();
+  lib::deque<std::string> copy(deque1);
+  EXPECT_TRUE(copy.empty());
+  deque1.push_back("d");
+  deque1.push_front("c");
+  ASSERT_EQ(deque1.size(), 2);
+  EXPECT_EQ(deque1.front(), "c");
+  EXPECT_EQ(deque1.back(), "d");
+
+  deque2 = std::move(deque1);
+  ASSERT_EQ(deque2.size(), 2);
+  deque1.insert(deque1.end(), {"x", "y", "z"});
+  ASSERT_EQ(deque1.size(), 3);
+  EXPECT_EQ(deque1[1], "y");
+
+  lib::deque<std::string> deque3(std::move(deque1));
+  deque1.emplace_front("w");
+  EXPECT_EQ(deque1.size(), 1);
+  deque1 = deque3;
+  EXPECT_EQ(deque1.size(), 3);
+}
+
 TEST(ElementAccess, at) {
   lib::deque<int> deque1{1, 2, 3, 4, 5, 6, 7, 8, 9};
   for (unsigned int idx{0}; idx < deque1.size(); ++idx) {
@@ -257,6 +305,40 @@ TEST(Iterator, IteratorOperations) {
   EXPECT_TRUE(deque3.begin() == deque3.end());
 }
 
+TEST(Iterator, RandomAccess) {
+  lib::deque<int> deque1;
+  for (int value{0}; value < 3000; ++value) {
+    deque1.push_front(3 * value % 1000);
+  }
+  auto it = deque1.begin();
+  it += 1500;
+  EXPECT_EQ(it - deque1.begin(), 1500);
+  EXPECT_EQ(*it, deque1[1500]);
+  it -= 1499;
+  EXPECT_EQ(*it, deque1[1]);
+  EXPECT_EQ(it[2000], deque1[2001]);
+  EXPECT_EQ(*(deque1.end() - 3000), deque1.front());
+  EXPECT_TRUE(deque1.begin() < it);
+  EXPECT_TRUE(deque1.end() > it);
+  EXPECT_TRUE(it <= it);
+  EXPECT_TRUE(it >= deque1.begin() + 1);
+  EXPECT_EQ(*deque1.rbegin(), deque1.back());
+  EXPECT_EQ(*(deque1.rend() - 1), deque1.front());
+
+  std::sort(deque1.begin(), deque1.end());
+  EXPECT_TRUE(std::is_sorted(deque1.cbegin(), deque1.cend()));
+  EXPECT_EQ(*std::lower_bound(deque1.begin(), deque1.end(), 500), 500);
+  std::reverse(deque1.begin(), deque1.end());
+  EXPECT_EQ(deque1.front(), 999);
+  EXPECT_EQ(deque1.back(), 0);
+
+  const lib::deque<int> &deque2 = deque1;
+  lib::deque<int>::const_iterator const_it = deque1.begin() + 10;
+  EXPECT_EQ(const_it, deque2.begin() + 10);
+  EXPECT_TRUE(const_it < deque2.end());
+  EXPECT_EQ(std::distance(deque2.begin(), deque2.end()), 3000);
+}
+
 TEST(ConstIterator, ConstIteratorOperations) {
   lib::deque<int> deque1{1, 2, 3, 4, 5};
   EXPECT_FALSE(deque1.cbegin() == deque1.cend());
@@ -295,6 +377,14 @@ TEST(ConstIterator, ConstIteratorOperations) {
   EXPECT_TRUE(deque3.cbegin() == deque3.cend());
 }
 
+TEST(ConstIterator, ReverseIterators) {
+  const lib::deque<int> deque1{1, 2, 3, 4, 5};
+  std::vector<int> reversed(deque1.rbegin(), deque1.rend());
+  EXPECT_EQ(reversed, std::vector<int>({5, 4, 3, 2, 1}));
+  EXPECT_TRUE(deque1.rbegin() == deque1.crbegin());
+  EXPECT_TRUE(deque1.rend() == deque1.crend());
+}
+
 TEST(Capacity, empty) {
   lib::deque<int> deque1;
   EXPECT_TRUE(deque1.empty());
@@ -346,6 +436,52 @@ TEST(Capacity, shrink_to_fit) {
   deque1.push_back(3);
 }
 
+TEST(Capacity, BlockSize) {
+  EXPECT_EQ(sc::deque_block_size<char>(), 4096);
+  EXPECT_EQ(sc::deque_block_size<int>(), 1024);
+  EXPECT_EQ(sc::deque_block_size<char[1000]>(), 16);
+
+  sc::deque<int> deque1;
+  for (int value{0}; value < 5000; ++value) {
+    deque1.push_back(value);
+    deque1.push_front(-value);
+  }
+  EXPECT_EQ(deque1.size(), 10000);
+  EXPECT_EQ(deque1.front(), -4999);
+  EXPECT_EQ(deque1.back(), 4999);
+  EXPECT_EQ(deque1[5000], 0);
+}
+
+TEST(Modifiers, NonTrivialElements) {
+  lib::deque<std::string> deque1;
+  for (int value{0}; value < 100; ++value) {
+    deque1.push_back(std::to_string(value));
+  }
+  deque1.insert(deque1.begin() + 10, std::string(50, 'a'));
+  deque1.insert(deque1.begin() + 90, std::string(50, 'b'));
+  EXPECT_EQ(deque1.size(), 102);
+  EXPECT_EQ(deque1[10], std::string(50, 'a'));
+  EXPECT_EQ(deque1[11], "10");
+  EXPECT_EQ(deque1[90], std::string(50, 'b'));
+  EXPECT_EQ(deque1[91], "89");
+  deque1.erase(deque1.begin() + 5, deque1.begin() + 15);
+  EXPECT_EQ(deque1[5], "14");
+  deque1.erase(deque1.end() - 20, deque1.end() - 10);
+  EXPECT_EQ(deque1.size(), 82);
+  EXPECT_EQ(deque1.back(), "99");
+  EXPECT_EQ(deque1[71], "80");
+  EXPECT_EQ(deque1[72], "90");
+
+  lib::deque<std::string> deque2(deque1);
+  deque1.clear();
+  EXPECT_TRUE(deque1.empty());
+  EXPECT_EQ(deque2.size(), 82);
+  deque1 = deque2;
+  EXPECT_EQ(deque1[5], "14");
+  deque2 = std::move(deque1);
+  EXPECT_EQ(deque2.back(), "99");
+}
+
 TEST(Modifiers, clear) {
   lib::deque<int> deque1;
   EXPECT_TRUE(deque1.empty());
@@ -365,17 +501,23 @@ TEST(Modifiers, clear) {
 
 TEST(Modifiers, InsertValue) {
   lib::deque<int> deque1{3};
-  EXPECT_EQ(deque1.insert(deque1.begin(), 1), deque1.begin());
-  EXPECT_EQ(deque1.insert(++deque1.begin(), 2), ++deque1.begin());
+  auto result1 = deque1.insert(deque1.begin(), 1);
+  EXPECT_EQ(result1, deque1.begin());
+  result1 = deque1.insert(++deque1.begin(), 2);
+  EXPECT_EQ(result1, ++deque1.begin());
   EXPECT_EQ(deque1.back(), 3);
   EXPECT_EQ(deque1.size(), 3);
   int expected = 0;
   for (int value = 4; value < 30; ++value) {
-    EXPECT_EQ(deque1.insert(deque1.end(), value), --deque1.end());
-  }
-  EXPECT_EQ(deque1.insert(deque1.end(), 32), --deque1.end());
-  EXPECT_EQ(deque1.insert(--deque1.end(), 31), deque1.end() - 2);
-  EXPECT_EQ(deque1.insert(deque1.end() - 2, 30), deque1.end() - 3);
+    result1 = deque1.insert(deque1.end(), value);
+    EXPECT_EQ(result1, --deque1.end());
+  }
+  result1 = deque1.insert(deque1.end(), 32);
+  EXPECT_EQ(result1, --deque1.end());
+  result1 = deque1.insert(--deque1.end(), 31);
+  EXPECT_EQ(result1, deque1.end() - 2);
+  result1 = deque1.insert(deque1.end() - 2, 30);
+  EXPECT_EQ(result1, deque1.end() - 3);
   EXPECT_EQ(deque1.size(), 32);
   expected = 0;
   for (int value : deque1) {
@@ -383,26 +525,32 @@ TEST(Modifiers, InsertValue) {
   }
 
   lib::deque<int> deque2;
-  EXPECT_EQ(deque2.insert(deque2.begin(), -22), deque2.begin());
+  auto result2 = deque2.insert(deque2.begin(), -22);
+  EXPECT_EQ(result2, deque2.begin());
   EXPECT_EQ(deque2.front(), -22);
   EXPECT_EQ(deque2.front(), deque2.back());
-  EXPECT_EQ(deque2.insert(deque2.end(), 20), deque2.end() - 1);
+  result2 = deque2.insert(deque2.end(), 20);
+  EXPECT_EQ(result2, deque2.end() - 1);
   EXPECT_EQ(deque2.front(), -22);
   EXPECT_EQ(deque2.back(), 20);
-  EXPECT_EQ(deque2.insert(--deque2.end(), 10), deque2.end() - 2);
+  result2 = deque2.insert(--deque2.end(), 10);
+  EXPECT_EQ(result2, deque2.end() - 2);
   EXPECT_EQ(deque2.front(), -22);
   EXPECT_EQ(deque2.back(), 20);
   EXPECT_EQ(*(deque2.end() - 2), 10);
   EXPECT_EQ(deque2.size(), 3);
 
   sc::deque<int, 2> deque3;
-  EXPECT_EQ(deque3.insert(deque3.begin(), -22), deque3.begin());
+  auto result3 = deque3.insert(deque3.begin(), -22);
+  EXPECT_EQ(result3, deque3.begin());
   EXPECT_EQ(deque3.front(), -22);
   EXPECT_EQ(deque3.front(), deque3.back());
-  EXPECT_EQ(deque3.insert(deque3.end(), 20), deque3.end() - 1);
+  result3 = deque3.insert(deque3.end(), 20);
+  EXPECT_EQ(result3, deque3.end() - 1);
   EXPECT_EQ(deque3.front(), -22);
   EXPECT_EQ(deque3.back(), 20);
-  EXPECT_EQ(deque3.insert(--deque3.end(), 10), deque3.end() - 2);
+  result3 = deque3.insert(--deque3.end(), 10);
+  EXPECT_EQ(result3, deque3.end() - 2);
   EXPECT_EQ(deque3.front(), -22);
   EXPECT_EQ(deque3.back(), 20);
   EXPECT_EQ(*(deque3.end() - 2), 10);
@@ -420,7 +568,8 @@ TEST(Modifiers, InsertValue) {
 
 TEST(Modifiers, InsertCopies) {
   sc::deque<int> deque1;
-  EXPECT_EQ(deque1.insert(5, 99, deque1.begin()), deque1.begin());
+  auto result1 = deque1.insert(5, 99, deque1.begin());
+  EXPECT_EQ(result1, deque1.begin());
   EXPECT_EQ(deque1.size(), 5);
   int counter{0};
   for (int value : deque1) {
@@ -428,7 +577,8 @@ TEST(Modifiers, InsertCopies) {
     ++counter;
   }
   EXPECT_EQ(counter, 5);
-  EXPECT_EQ(deque1.insert(9, 1, deque1.begin()), deque1.begin());
+  result1 = deque1.insert(9, 1, deque1.begin());
+  EXPECT_EQ(result1, deque1.begin());
   EXPECT_EQ(deque1.size(), 14);
   for (unsigned int index{0}; index < deque1.size(); ++index) {
     if (index < 9) {
@@ -437,16 +587,22 @@ TEST(Modifiers, InsertCopies) {
       EXPECT_EQ(deque1[index], 99);
     }
   }
-  EXPECT_EQ(deque1.insert(0, 0, deque1.begin()), deque1.begin());
-  EXPECT_EQ(deque1.insert(0, 0, deque1.end()), deque1.end());
+  result1 = deque1.insert(0, 0, deque1.begin());
+  EXPECT_EQ(result1, deque1.begin());
+  result1 = deque1.insert(0, 0, deque1.end());
+  EXPECT_EQ(result1, deque1.end());
 
   sc::deque<int, 7> deque2;
-  EXPECT_EQ(deque2.insert(0, 2, deque2.end()), deque2.end());
-  EXPECT_EQ(deque2.insert(0, 2, deque2.begin()), deque2.end());
+  auto result2 = deque2.insert(0, 2, deque2.end());
+  EXPECT_EQ(result2, deque2.end());
+  result2 = deque2.insert(0, 2, deque2.begin());
+  EXPECT_EQ(result2, deque2.end());
   EXPECT_EQ(deque2.size(), 0);
-  EXPECT_EQ(deque2.insert(1, 2, deque2.begin()), deque2.begin());
+  result2 = deque2.insert(1, 2, deque2.begin());
+  EXPECT_EQ(result2, deque2.begin());
   EXPECT_EQ(deque2.size(), 1);
-  EXPECT_EQ(deque2.insert(2, 9, deque2.end()), ++deque2.begin());
+  result2 = deque2.insert(2, 9, deque2.end());
+  EXPECT_EQ(result2, ++deque2.begin());
   EXPECT_EQ(deque2.size(), 3);
   for (unsigned int index{0}; index < deque2.size(); ++index) {
     if (index < 1) {
@@ -455,11 +611,14 @@ TEST(Modifiers, InsertCopies) {
       EXPECT_EQ(deque2[index], 9);
     }
   }
-  EXPECT_EQ(deque2.insert(0, 0, deque2.begin()), deque2.begin());
-  EXPECT_EQ(deque2.insert(0, 0, deque2.end()), deque2.end());
+  result2 = deque2.insert(0, 0, deque2.begin());
+  EXPECT_EQ(result2, deque2.begin());
+  result2 = deque2.insert(0, 0, deque2.end());
+  EXPECT_EQ(result2, deque2.end());
 
   sc::deque<char, 4> deque3;
-  EXPECT_EQ(deque3.insert(100, 'c', deque3.end()), deque3.begin());
+  auto result3 = deque3.insert(100, 'c', deque3.end());
+  EXPECT_EQ(result3, deque3.begin());
   EXPECT_EQ(deque3.size(), 100);
   for (char element : deque3) {
     EXPECT_EQ(element, 'c');
@@ -471,14 +630,15 @@ TEST(Modifiers, InsertRange) {
   int array2[] = {1, 2, 3, 4, 5, 10, 9, 8, 7, 6};
 
   lib::deque<int> deque1;
-  EXPECT_EQ(deque1.insert(deque1.begin(), array, array + 5), deque1.begin());
+  auto result1 = deque1.insert(deque1.begin(), array, array + 5);
+  EXPECT_EQ(result1, deque1.begin());
   EXPECT_EQ(deque1.size(), 5);
   int expected{6};
   for (int value : deque1) {
     EXPECT_EQ(value, --expected);
   }
-  EXPECT_EQ(deque1.insert(deque1.begin(), array2 + 5, array2 + 10),
-            deque1.begin());
+  result1 = deque1.insert(deque1.begin(), array2 + 5, array2 + 10);
+  EXPECT_EQ(result1, deque1.begin());
   EXPECT_EQ(deque1.size(), 10);
   expected = 11;
   for (int value : deque1) {
@@ -486,12 +646,13 @@ TEST(Modifiers, InsertRange) {
   }
 
   lib::deque<int> deque2;
-  EXPECT_EQ(deque2.insert(deque2.end(), array2, array2 + 4), deque2.begin());
+  auto result2 = deque2.insert(deque2.end(), array2, array2 + 4);
+  EXPECT_EQ(result2, deque2.begin());
   EXPECT_EQ(deque2.size(), 4);
-  EXPECT_EQ(deque2.insert(deque2.end(), array2 + 4, array2 + 5),
-            --deque2.end());
-  EXPECT_EQ(deque2.insert(deque2.end(), array + 5, array + 10),
-            deque2.end() - 5);
+  result2 = deque2.insert(deque2.end(), array2 + 4, array2 + 5);
+  EXPECT_EQ(result2, --deque2.end());
+  result2 = deque2.insert(deque2.end(), array + 5, array + 10);
+  EXPECT_EQ(result2, deque2.end() - 5);
   EXPECT_EQ(deque2.size(), 10);
   expected = 0;
   for (int value : deque2) {
@@ -501,13 +662,18 @@ TEST(Modifiers, InsertRange) {
 
 TEST(Modifiers, InsertInitializerList) {
   lib::deque<int> deque1;
-  EXPECT_EQ(deque1.insert(deque1.begin(), {}), deque1.end());
-  EXPECT_EQ(deque1.insert(deque1.end(), {}), deque1.end());
+  auto result1 = deque1.insert(deque1.begin(), {});
+  EXPECT_EQ(result1, deque1.end());
+  result1 = deque1.insert(deque1.end(), {});
+  EXPECT_EQ(result1, deque1.end());
   EXPECT_EQ(deque1.size(), 0);
   EXPECT_EQ(deque1.begin(), deque1.end());
-  EXPECT_EQ(deque1.insert(deque1.begin(), {1, 2, 3}), deque1.begin());
-  EXPECT_EQ(deque1.insert(deque1.begin() + 1, {}), deque1.begin() + 1);
-  EXPECT_EQ(deque1.insert(deque1.end(), {4, 5, 6}), deque1.begin() + 3);
+  result1 = deque1.insert(deque1.begin(), {1, 2, 3});
+  EXPECT_EQ(result1, deque1.begin());
+  result1 = deque1.insert(deque1.begin() + 1, {});
+  EXPECT_EQ(result1, deque1.begin() + 1);
+  result1 = deque1.insert(deque1.end(), {4, 5, 6});
+  EXPECT_EQ(result1, deque1.begin() + 3);
   EXPECT_EQ(deque1.size(), 6);
   int expected = 0;
   for (int value : deque1) {
@@ -516,10 +682,14 @@ TEST(Modifiers, InsertInitializerList) {
   EXPECT_EQ(expected, 6);
 
   sc::deque<int, 2> deque2;
-  EXPECT_EQ(deque2.insert(deque2.end(), {7, 8, 9}), deque2.begin());
-  EXPECT_EQ(deque2.insert(deque2.begin(), {1, 2, 3}), deque2.begin());
-  EXPECT_EQ(deque2.insert(deque2.begin() + 3, {4, 5, 6}), deque2.begin() + 3);
-  EXPECT_EQ(deque2.insert(deque2.end(), {10, 11, 12}), deque2.end() - 3);
+  auto result2 = deque2.insert(deque2.end(), {7, 8, 9});
+  EXPECT_EQ(result2, deque2.begin());
+  result2 = deque2.insert(deque2.begin(), {1, 2, 3});
+  EXPECT_EQ(result2, deque2.begin());
+  result2 = deque2.insert(deque2.begin() + 3, {4, 5, 6});
+  EXPECT_EQ(result2, deque2.begin() + 3);
+  result2 = deque2.insert(deque2.end(), {10, 11, 12});
+  EXPECT_EQ(result2, deque2.end() - 3);
   expected = 0;
   for (int value : deque2) {
     EXPECT_EQ(value, ++expected);
@@ -529,9 +699,11 @@ TEST(Modifiers, InsertInitializerList) {
 
 TEST(Modifiers, Erase) {
   lib::deque<int> deque1{-22, 1, 2, 9, 3, 4, 5, 10};
-  EXPECT_EQ(deque1.erase(deque1.begin()), deque1.begin());
+  auto result1 = deque1.erase(deque1.begin());
+  EXPECT_EQ(result1, deque1.begin());
   EXPECT_EQ(*deque1.begin(), 1);
-  EXPECT_EQ(deque1.erase(deque1.end() - 1), deque1.end());
+  result1 = deque1.erase(deque1.end() - 1);
+  EXPECT_EQ(result1, deque1.end());
   auto it = deque1.erase(deque1.begin() + 2);
   EXPECT_EQ(it, deque1.begin() + 2);
   EXPECT_EQ(*it, 3);
@@ -543,9 +715,11 @@ TEST(Modifiers, Erase) {
   EXPECT_EQ(expected, 5);
 
   sc::deque<int, 7> deque2{-22, 1, 2, 9, 3, 4, 5, 10};
-  EXPECT_EQ(deque2.erase(deque2.begin()), deque2.begin());
+  auto result2 = deque2.erase(deque2.begin());
+  EXPECT_EQ(result2, deque2.begin());
   EXPECT_EQ(*deque2.begin(), 1);
-  EXPECT_EQ(deque2.erase(deque2.end() - 1), deque2.end());
+  result2 = deque2.erase(deque2.end() - 1);
+  EXPECT_EQ(result2, deque2.end());
   auto it2 = deque2.erase(deque2.begin() + 2);
   EXPECT_EQ(it2, deque2.begin() + 2);
   EXPECT_EQ(*it2, 3);
@@ -559,8 +733,8 @@ TEST(Modifiers, Erase) {
 
 TEST(Modifiers, EraseRange) {
   lib::deque<int> deque1{100, 9, 77, 1, 2, 3, 4, 5, 10, 1, 12};
-  EXPECT_EQ(deque1.erase(deque1.begin() + 3, deque1.begin() + 3),
-            deque1.begin() + 3);
+  auto result1 = deque1.erase(deque1.begin() + 3, deque1.begin() + 3);
+  EXPECT_EQ(result1, deque1.begin() + 3);
   auto it = deque1.erase(deque1.begin(), deque1.begin() + 3);
   EXPECT_EQ(it, deque1.begin());
   EXPECT_EQ(*it, 1);
@@ -574,8 +748,8 @@ TEST(Modifiers, EraseRange) {
   EXPECT_EQ(expected, 5);
 
   sc::deque<int, 5> deque2{100, 9, 77, 1, 2, 3, 4, 5, 10, 1, 12};
-  EXPECT_EQ(deque2.erase(deque2.begin() + 3, deque2.begin() + 3),
-            deque2.begin() + 3);
+  auto result2 = deque2.erase(deque2.begin() + 3, deque2.begin() + 3);
+  EXPECT_EQ(result2, deque2.begin() + 3);
   auto it2 = deque2.erase(deque2.begin(), deque2.begin() + 3);
   EXPECT_EQ(it2, deque2.begin());
   EXPECT_EQ(*it2, 1);
@@ -629,6 +803,150 @@ TEST(Modifiers, push_front) {
   EXPECT_EQ(deque2.size(), 2);
 }
 
+TEST(Modifiers, emplace_back) {
+  lib::deque<std::unique_ptr<int>> deque1;
+  for (int value{0}; value < 100; ++value) {
+    EXPECT_EQ(*deque1.emplace_back(new int(value)), value);
+  }
+  deque1.push_back(std::make_unique<int>(100));
+  EXPECT_EQ(deque1.size(), 101);
+  for (int value{0}; value <= 100; ++value) {
+    EXPECT_EQ(*deque1[value], value);
+  }
+
+  sc::deque<std::string, 2> deque2;
+  deque2.emplace_back(3, 'a');
+  deque2.emplace_back("bb");
+  deque2.emplace_back();
+  EXPECT_EQ(deque2.size(), 3);
+  EXPECT_EQ(deque2.front(), "aaa");
+  EXPECT_EQ(deque2[1], "bb");
+  EXPECT_TRUE(deque2.back().empty());
+}
+
+TEST(Modifiers, emplace_front) {
+  lib::deque<std::unique_ptr<int>> deque1;
+  for (int value{0}; value < 100; ++value) {
+    EXPECT_EQ(*deque1.emplace_front(new int(value)), value);
+  }
+  deque1.push_front(std::make_unique<int>(100));
+  EXPECT_EQ(deque1.size(), 101);
+  for (int value{0}; value <= 100; ++value) {
+    EXPECT_EQ(*deque1[100 - value], value);
+  }
+
+  sc::deque<std::string, 2> deque2;
+  deque2.emplace_front(3, 'a');
+  deque2.emplace_front("bb");
+  deque2.emplace_front();
+  EXPECT_EQ(deque2.size(), 3);
+  EXPECT_EQ(deque2.back(), "aaa");
+  EXPECT_EQ(deque2[1], "bb");
+  EXPECT_TRUE(deque2.front().empty());
+}
+
+TEST(Modifiers, PushAndPopAtBothEnds) {
+  sc::deque<int, 4> deque1;
+  for (int round{0}; round < 3; ++round) {
+    for (int value{0}; value < 50; ++value) {
+      deque1.push_back(value);
+      deque1.push_front(-value);
+    }
+    for (int value{49}; value >= 0; --value) {
+      EXPECT_EQ(deque1.back(), value);
+      deque1.pop_back();
+      EXPECT_EQ(deque1.front(), -value);
+      deque1.pop_front();
+    }
+    EXPECT_TRUE(deque1.empty());
+    EXPECT_EQ(deque1.begin(), deque1.end());
+  }
+  // Queue behavior, walking through many blocks.
+  for (int value{0}; value < 1000; ++value) {
+    deque1.push_back(value);
+    if (value % 3 == 2) {
+      EXPECT_EQ(deque1.front(), value / 3);
+      deque1.pop_front();
+    }
+  }
+  EXPECT_EQ(deque1.size(), 667);
+  EXPECT_EQ(deque1.front(), 333);
+}
+
+TEST(Modifiers, GrowsAtBothEnds) {
+  // Enough elements to reallocate the map of blocks many times at each end.
+  constexpr int count{20'000};
+  lib::deque<int> deque1;
+  for (int value{0}; value < count; ++value) {
+    deque1.push_back(value);
+    deque1.push_front(-value - 1);
+  }
+  ASSERT_EQ(deque1.size(), 2 * count);
+  for (int index{0}; index < 2 * count; ++index) {
+    ASSERT_EQ(deque1[index], index - count);
+  }
+
+  lib::deque<int> deque2;
+  for (int value{0}; value < count; ++value) {
+    deque2.push_front(value);
+  }
+  for (int value{0}; value < count; ++value) {
+    deque2.push_back(value);
+  }
+  ASSERT_EQ(deque2.size(), 2 * count);
+  EXPECT_EQ(deque2.front(), count - 1);
+  EXPECT_EQ(deque2[count - 1], 0);
+  EXPECT_EQ(deque2[count], 0);
+  EXPECT_EQ(deque2.back(), count - 1);
+}
+
+TEST(Modifiers, QueueReusesBlocks) {
+  // Once warmed up, every element must land in a slot already used before,
+  // since nothing is deallocated a new block would have a new address.
+  sc::deque<int, 4> deque1;
+  std::set<int *> warm_slots;
+  int next_in{0}, next_out{0};
+  for (; next_in < 100; ++next_in) {
+    deque1.push_back(next_in);
+  }
+  for (int round{0}; round < 1000; ++round) {
+    deque1.push_back(next_in++);
+    warm_slots.insert(&deque1.back());
+    EXPECT_EQ(deque1.front(), next_out++);
+    deque1.pop_front();
+  }
+  for (int round{0}; round < 10000; ++round) {
+    deque1.push_back(next_in++);
+    EXPECT_EQ(warm_slots.count(&deque1.back()), 1);
+    EXPECT_EQ(deque1.front(), next_out++);
+    deque1.pop_front();
+  }
+  EXPECT_EQ(deque1.size(), 100);
+
+  // Same in the other direction.
+  warm_slots.clear();
+  for (int round{0}; round < 1000; ++round) {
+    deque1.push_front(next_in++);
+    warm_slots.insert(&deque1.front());
+    deque1.pop_back();
+  }
+  for (int round{0}; round < 10000; ++round) {
+    deque1.push_front(next_in);
+    EXPECT_EQ(warm_slots.count(&deque1.front()), 1);
+    EXPECT_EQ(deque1.front(), next_in++);
+    deque1.pop_back();
+  }
+  EXPECT_EQ(deque1.size(), 100);
+
+  deque1.clear();
+  deque1.shrink_to_fit();
+  for (int value{0}; value < 10; ++value) {
+    deque1.push_front(value);
+  }
+  EXPECT_EQ(deque1.back(), 0);
+  EXPECT_EQ(deque1.front(), 9);
+}
+
 TEST(Modifiers, pop_back) {
   lib::deque<int> deque{2, 4, 1, 8};
   deque.pop_back();
@@ -0,0 +1,110 @@
+#include "Deque/Deque.h"
+#include "Deque/SegmentedAlgorithms.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/*
+ * There are no segmented algorithms in "std", so the tests use the "sc"
+ * namespace directly and compare the results with the std algorithms over the
+ * same ranges. Small blocks are used so the ranges start and end at every
+ * position of a block, and the deques grow in both directions so the head is
+ * not in the beginning of its block.
+ */
+
+namespace segmented = sc::segmented;
+
+using small_deque = sc::deque<int, 4>;
+
+/// Creates a deque with the values [-count, count), grown from the middle.
+static small_deque filled(int count) {
+  small_deque result;
+  for (int value{0}; value < count; ++value) {
+    result.push_back(value);
+    result.push_front(-value - 1);
+  }
+  return result;
+}
+
+TEST(Segments, ForEachSegment) {
+  small_deque deque1 = filled(10);
+  for (int first{0}; first <= 20; ++first) {
+    for (int last{first}; last <= 20; ++last) {
+      std::vector<int> visited;
+      segmented::for_each_segment(
+          deque1.begin() + first, deque1.begin() + last,
+          [&visited](int *begin, int *end) {
+            EXPECT_LE(end - begin, 4);
+            visited.insert(visited.end(), begin, end);
+          });
+      EXPECT_TRUE(std::equal(visited.begin(), visited.end(),
+                             deque1.begin() + first, deque1.begin() + last));
+    }
+  }
+}
+
+TEST(Algorithms, for_each) {
+  small_deque deque1 = filled(50);
+  for (int first : {0, 1, 3, 4, 50}) {
+    for (int last : {50, 51, 97, 99, 100}) {
+      long total{0};
+      segmented::for_each(deque1.cbegin() + first, deque1.cbegin() + last,
+                          [&total](int value) { total += value; });
+      long expected{0};
+      std::for_each(deque1.cbegin() + first, deque1.cbegin() + last,
+                    [&expected](int value) { expected += value; });
+      EXPECT_EQ(total, expected);
+    }
+  }
+  segmented::for_each(deque1.begin(), deque1.end(), [](int &value) {
+    value *= 2;
+  });
+  EXPECT_EQ(deque1.front(), -100);
+  EXPECT_EQ(deque1.back(), 98);
+}
+
+TEST(Algorithms, copy) {
+  small_deque deque1 = filled(25);
+  for (int first : {0, 2, 4, 13}) {
+    for (int last : {13, 17, 49, 50}) {
+      std::vector<int> copied(last - first);
+      auto end = segmented::copy(deque1.begin() + first, deque1.begin() + last,
+                                 copied.begin());
+      EXPECT_EQ(end, copied.end());
+      EXPECT_TRUE(std::equal(copied.begin(), copied.end(),
+                             deque1.begin() + first));
+    }
+  }
+  sc::deque<std::string, 3> deque2{"a", "b", "c", "d", "e"};
+  std::vector<std::string> copied;
+  segmented::copy(deque2.cbegin(), deque2.cend(), std::back_inserter(copied));
+  EXPECT_EQ(copied, (std::vector<std::string>{"a", "b", "c", "d", "e"}));
+}
+
+TEST(Algorithms, find) {
+  small_deque deque1 = filled(20);
+  for (int value{-20}; value < 20; ++value) {
+    auto found = segmented::find(deque1.begin(), deque1.end(), value);
+    EXPECT_EQ(found, std::find(deque1.begin(), deque1.end(), value));
+    EXPECT_EQ(*found, value);
+  }
+  EXPECT_EQ(segmented::find(deque1.begin(), deque1.end(), 20), deque1.end());
+  // Not found inside a sub range, even if present outside of it.
+  auto last = deque1.begin() + 9;
+  EXPECT_EQ(segmented::find(deque1.begin() + 1, last, -20), last);
+  EXPECT_EQ(segmented::find(deque1.begin() + 1, last, 0), last);
+  EXPECT_EQ(segmented::find(deque1.cbegin(), deque1.cend(), 7),
+            deque1.cbegin() + 27);
+
+  small_deque deque2;
+  EXPECT_EQ(segmented::find(deque2.begin(), deque2.end(), 0), deque2.end());
+  deque2.push_back(3);
+  deque2.push_back(3);
+  EXPECT_EQ(segmented::find(deque2.begin(), deque2.end(), 3), deque2.begin());
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,143 @@
+#include "Deque/WorkStealingDeque.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/*
+ * There is no work-stealing deque in "std", so the tests use the "sc"
+ * namespace directly. The last tests check that, with thieves racing the
+ * owner, every element is taken exactly once.
+ */
+
+TEST(SpecialFunctions, Constructor) {
+  sc::work_stealing_deque<int> deque1;
+  EXPECT_TRUE(deque1.empty());
+  EXPECT_EQ(deque1.size(), 0);
+  EXPECT_EQ(deque1.capacity(), 64);
+
+  sc::work_stealing_deque<int *> deque2(100);
+  EXPECT_TRUE(deque2.empty());
+  EXPECT_EQ(deque2.capacity(), 128);
+}
+
+TEST(Modifiers, OwnerIsLifo) {
+  sc::work_stealing_deque<int> deque;
+  for (int index{0}; index < 10; ++index) {
+    deque.push_back(index);
+  }
+  EXPECT_EQ(deque.size(), 10);
+  int value{-1};
+  for (int index{9}; index >= 0; --index) {
+    ASSERT_TRUE(deque.pop_back(value));
+    ASSERT_EQ(value, index);
+  }
+  EXPECT_FALSE(deque.pop_back(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(deque.empty());
+  // Popping from an empty deque must leave it usable.
+  deque.push_back(5);
+  EXPECT_TRUE(deque.pop_back(value));
+  EXPECT_EQ(value, 5);
+}
+
+TEST(Modifiers, ThievesAreFifo) {
+  sc::work_stealing_deque<int> deque;
+  for (int index{0}; index < 10; ++index) {
+    deque.push_back(index);
+  }
+  int value{-1};
+  EXPECT_TRUE(deque.steal(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(deque.steal(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(deque.pop_back(value));
+  EXPECT_EQ(value, 9);
+  EXPECT_EQ(deque.size(), 7);
+  for (int index{2}; index < 9; ++index) {
+    ASSERT_TRUE(deque.steal(value));
+    ASSERT_EQ(value, index);
+  }
+  EXPECT_FALSE(deque.steal(value));
+  EXPECT_FALSE(deque.pop_back(value));
+}
+
+TEST(Modifiers, Growth) {
+  sc::work_stealing_deque<int> deque(4);
+  int value{0};
+  // Moves the indexes away from zero, so that the elements wrap around.
+  for (int index{0}; index < 3; ++index) {
+    deque.push_back(index);
+    deque.steal(value);
+  }
+  for (int index{0}; index < 100; ++index) {
+    deque.push_back(index);
+  }
+  EXPECT_EQ(deque.size(), 100);
+  EXPECT_EQ(deque.capacity(), 128);
+  for (int index{0}; index < 50; ++index) {
+    ASSERT_TRUE(deque.steal(value));
+    ASSERT_EQ(value, index);
+  }
+  for (int index{99}; index >= 50; --index) {
+    ASSERT_TRUE(deque.pop_back(value));
+    ASSERT_EQ(value, index);
+  }
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST(Concurrency, EveryElementTakenOnce) {
+  constexpr int total{200'000};
+  constexpr int thieves{3};
+  sc::work_stealing_deque<int> deque(8);
+  std::atomic<bool> done{false};
+  std::vector<std::vector<int>> stolen(thieves);
+  std::vector<std::thread> threads;
+  for (int thief{0}; thief < thieves; ++thief) {
+    threads.emplace_back([&deque, &done, &stolen, thief] {
+      int value{0};
+      while (!done.load()) {
+        if (deque.steal(value)) {
+          stolen[thief].push_back(value);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  // The owner pushes in bursts and pops some of them back, so that it often
+  // races the thieves for the last element.
+  std::vector<int> popped;
+  int value{0};
+  for (int next{0}; next < total;) {
+    for (int burst{0}; burst < 3 && next < total; ++burst) {
+      deque.push_back(next++);
+    }
+    if (deque.pop_back(value)) {
+      popped.push_back(value);
+    }
+  }
+  while (deque.pop_back(value)) {
+    popped.push_back(value);
+  }
+  done.store(true);
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  for (auto &values : stolen) {
+    // Each thief gets the elements in the order they were pushed.
+    ASSERT_TRUE(std::is_sorted(values.begin(), values.end()));
+    popped.insert(popped.end(), values.begin(), values.end());
+  }
+  std::sort(popped.begin(), popped.end());
+  ASSERT_EQ(popped.size(), total);
+  for (int index{0}; index < total; ++index) {
+    ASSERT_EQ(popped[index], index);
+  }
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
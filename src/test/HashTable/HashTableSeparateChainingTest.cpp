@@ -176,6 +176,10 @@ TEST(Modifiers, clear) {
   EXPECT_FALSE(hash1.empty());
   hash1.clear();
   EXPECT_TRUE(hash1.empty());
+  // The elements are gone from the buckets, not only from the count.
+  for (int value{1}; value <= 4; ++value) {
+    EXPECT_EQ(hash1.count(value), 0);
+  }
   hash1.clear();
   EXPECT_TRUE(hash1.empty());
 }
@@ -201,7 +205,15 @@ TEST(Modifiers, EraseRange) {
 }
 
 TEST(Modifiers, EraseValue) {
-  // TODO
+  HashTable<int> hash1{1, 2, 2, 3, 2};
+  EXPECT_EQ(hash1.erase(2), 3);
+  EXPECT_EQ(hash1.size(), 2);
+  EXPECT_EQ(hash1.count(2), 0);
+  EXPECT_EQ(hash1.erase(5), 0);
+  EXPECT_EQ(hash1.size(), 2);
+  EXPECT_EQ(hash1.erase(1), 1);
+  EXPECT_EQ(hash1.erase(3), 1);
+  EXPECT_TRUE(hash1.empty());
 }
 
 TEST(Modifiers, merge) {
@@ -249,7 +261,13 @@ TEST(BucketInterface, bucket) {
 }
 
 TEST(HashPolicy, load_factor) {
-  // TODO
+  HashTable<int> hash1(10);
+  EXPECT_FLOAT_EQ(hash1.load_factor(), 0);
+  for (int value{0}; value < 5; ++value) {
+    hash1.insert(value);
+  }
+  EXPECT_FLOAT_EQ(hash1.load_factor(),
+                  hash1.size() / static_cast<float>(hash1.bucket_count()));
 }
 
 TEST(HashPolicy, max_load_factor) {
@@ -257,7 +275,23 @@ TEST(HashPolicy, max_load_factor) {
 }
 
 TEST(HashPolicy, rehash) {
-  // TODO
+  // Inserting grows the table to keep the load factor under the maximum.
+  HashTable<int> hash1(10);
+  for (int value{0}; value < 1000; ++value) {
+    hash1.insert(value);
+  }
+  EXPECT_GE(hash1.bucket_count(), hash1.size() / hash1.max_load_factor());
+  EXPECT_LE(hash1.load_factor(), hash1.max_load_factor());
+  for (int value{0}; value < 1000; ++value) {
+    ASSERT_EQ(hash1.count(value), 1);
+  }
+
+  hash1.rehash(5000);
+  EXPECT_GE(hash1.bucket_count(), 5000);
+  EXPECT_EQ(hash1.size(), 1000);
+  for (int value{0}; value < 1000; ++value) {
+    ASSERT_EQ(hash1.count(value), 1);
+  }
 }
 
 TEST(HashPolicy, reserve) {
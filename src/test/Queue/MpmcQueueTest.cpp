@@ -0,0 +1,172 @@
+#include "Queue/MpmcQueue.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * There is no lock-free queue in "std", so the tests use the "sc" namespace
+ * directly. The first tests run on a single thread, the last ones check that
+ * with many producers and consumers every element is received exactly once
+ * and in the order each producer inserted them.
+ */
+
+/// Element whose construction from an int throws for negative values.
+struct Picky {
+  explicit Picky(int number) : value{number} {
+    if (number < 0) {
+      throw std::invalid_argument("negative");
+    }
+  }
+  Picky() = default;
+  int value{0};
+};
+
+TEST(SpecialFunctions, DefaultConstructor) {
+  sc::mpmc_queue<int, 8> queue;
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.size(), 0);
+  EXPECT_EQ(queue.capacity(), 8);
+}
+
+TEST(SpecialFunctions, Destructor) {
+  auto shared = std::make_shared<int>(5);
+  {
+    sc::mpmc_queue<std::shared_ptr<int>, 4> queue;
+    queue.push(shared);
+    queue.push(shared);
+    std::shared_ptr<int> value;
+    queue.pop(value);
+    queue.push(shared);
+    EXPECT_EQ(shared.use_count(), 4);
+  }
+  EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(Modifiers, PushAndPop) {
+  sc::mpmc_queue<std::string, 4> queue;
+  queue.push("a");
+  std::string value{"b"};
+  queue.push(value);
+  queue.emplace(3, 'c');
+  EXPECT_EQ(queue.size(), 3);
+  queue.pop(value);
+  EXPECT_EQ(value, "a");
+  queue.pop(value);
+  EXPECT_EQ(value, "b");
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, "ccc");
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(Modifiers, FullAndEmpty) {
+  sc::mpmc_queue<int, 4> queue;
+  int value{-1};
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_EQ(value, -1);
+  for (int index{0}; index < 4; ++index) {
+    EXPECT_TRUE(queue.try_push(index));
+  }
+  EXPECT_FALSE(queue.try_push(4));
+  EXPECT_FALSE(queue.try_emplace(4));
+  EXPECT_EQ(queue.size(), 4);
+
+  // Goes around the ring a few times.
+  for (int index{4}; index < 40; ++index) {
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(value, index - 4);
+    ASSERT_TRUE(queue.try_push(index));
+  }
+  EXPECT_EQ(queue.size(), 4);
+}
+
+TEST(Modifiers, ThrowingConstructor) {
+  sc::mpmc_queue<Picky, 2> queue;
+  EXPECT_TRUE(queue.try_emplace(1));
+  EXPECT_THROW(queue.emplace(-1), std::invalid_argument);
+  EXPECT_THROW(queue.try_emplace(-2), std::invalid_argument);
+  // The failed insertions did not take a cell.
+  EXPECT_EQ(queue.size(), 1);
+  EXPECT_TRUE(queue.try_emplace(2));
+  EXPECT_FALSE(queue.try_emplace(3));
+  Picky value;
+  queue.pop(value);
+  EXPECT_EQ(value.value, 1);
+  queue.pop(value);
+  EXPECT_EQ(value.value, 2);
+}
+
+TEST(Modifiers, MoveOnlyElements) {
+  sc::mpmc_queue<std::unique_ptr<int>, 2> queue;
+  queue.push(std::make_unique<int>(1));
+  std::unique_ptr<int> value;
+  queue.pop(value);
+  EXPECT_EQ(*value, 1);
+}
+
+TEST(Concurrency, ManyProducersManyConsumers) {
+  constexpr int producers{4};
+  constexpr int consumers{4};
+  constexpr int per_producer{50'000};
+  sc::mpmc_queue<int, 64> queue;
+  std::vector<std::thread> threads;
+  for (int producer{0}; producer < producers; ++producer) {
+    // Half of the threads use the blocking functions, half the try_ ones.
+    threads.emplace_back([&queue, producer] {
+      for (int index{0}; index < per_producer; ++index) {
+        if (producer % 2 == 0) {
+          queue.push(producer * per_producer + index);
+        } else {
+          while (!queue.try_push(producer * per_producer + index)) {
+            std::this_thread::yield();
+          }
+        }
+      }
+    });
+  }
+  // Every consumer checks that it gets the values of a producer in order.
+  std::vector<std::vector<int>> received(consumers);
+  for (int consumer{0}; consumer < consumers; ++consumer) {
+    threads.emplace_back([&queue, &received, consumer] {
+      std::vector<int> last(producers, -1);
+      int value{0};
+      for (int count{0}; count < producers * per_producer / consumers;
+           ++count) {
+        if (consumer % 2 == 0) {
+          queue.pop(value);
+        } else {
+          while (!queue.try_pop(value)) {
+            std::this_thread::yield();
+          }
+        }
+        int producer = value / per_producer;
+        if (value <= last[producer]) {
+          return; // Leaves the rest unreceived, which fails the test.
+        }
+        last[producer] = value;
+        received[consumer].push_back(value);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  std::vector<int> all;
+  for (auto &values : received) {
+    all.insert(all.end(), values.begin(), values.end());
+  }
+  std::sort(all.begin(), all.end());
+  ASSERT_EQ(all.size(), producers * per_producer);
+  for (int index{0}; index < producers * per_producer; ++index) {
+    ASSERT_EQ(all[index], index);
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
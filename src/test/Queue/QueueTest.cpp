@@ -1,15 +1,22 @@
+#include "../Adapter/MinimalDeque.h"
 #include "Queue/Queue.h"
 #include "gtest/gtest.h"
 #include <initializer_list>
+#include <iterator>
 #include <list>
 #include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 /*
  * The "lib" macro can be used to select which lib to test. To ensure the
  * integrity of the tests, the "std" namespace must be used, to effectively test
- * the vector developed the "sc" namespace must be used. Note: the test for the
- * range constructor does not use the "lib" macro, because it is not compatible
- * with "std", instead the namespace "sc" is used directly.
+ * the vector developed the "sc" namespace must be used. Note: the tests for the
+ * range constructor and for the batch functions (push_range, pop_n and drain)
+ * do not use the "lib" macro, because they are not compatible with "std",
+ * instead the namespace "sc" is used directly.
  */
 #define lib sc
 // #define lib std
@@ -213,6 +220,87 @@ TEST(Modifiers, pop) {
   }
 }
 
+TEST(Modifiers, push_range) {
+  std::vector<int> values{1, 2, 3, 4, 5};
+  sc::queue<int> queue1;
+  queue1.push(0);
+  queue1.push_range(values.begin(), values.end());
+  queue1.push_range(values.end(), values.end());
+  ASSERT_EQ(queue1.size(), 6);
+  for (int counter{0}; counter < 6; ++counter) {
+    EXPECT_EQ(queue1.front(), counter);
+    queue1.pop();
+  }
+
+  // Input iterators and containers without range insert push one by one.
+  std::istringstream input("1 2 3");
+  sc::queue<int, minimal_deque<int>> queue2;
+  queue2.push_range(std::istream_iterator<int>(input),
+                    std::istream_iterator<int>());
+  ASSERT_EQ(queue2.size(), 3);
+  EXPECT_EQ(queue2.front(), 1);
+  EXPECT_EQ(queue2.back(), 3);
+}
+
+TEST(Modifiers, pop_n) {
+  std::vector<std::string> values{"a", "b", "c", "d", "e"};
+  sc::queue<std::string> queue1;
+  queue1.push_range(values.begin(), values.end());
+  std::vector<std::string> popped;
+  EXPECT_EQ(queue1.pop_n(std::back_inserter(popped), 2), 2);
+  EXPECT_EQ(popped, (std::vector<std::string>{"a", "b"}));
+  EXPECT_EQ(queue1.front(), "c");
+  EXPECT_EQ(queue1.pop_n(std::back_inserter(popped), 10), 3);
+  EXPECT_EQ(popped, values);
+  EXPECT_TRUE(queue1.empty());
+  EXPECT_EQ(queue1.pop_n(std::back_inserter(popped), 10), 0);
+
+  sc::queue<std::string, std::list<std::string>> queue2;
+  queue2.push_range(values.begin(), values.end());
+  std::vector<std::string> buffer(4);
+  EXPECT_EQ(queue2.pop_n(buffer.begin(), 4), 4);
+  EXPECT_EQ(buffer, (std::vector<std::string>{"a", "b", "c", "d"}));
+  EXPECT_EQ(queue2.size(), 1);
+
+  sc::queue<std::string, minimal_deque<std::string>> queue3;
+  queue3.push_range(values.begin(), values.end());
+  EXPECT_EQ(queue3.pop_n(buffer.begin(), 4), 4);
+  EXPECT_EQ(buffer, (std::vector<std::string>{"a", "b", "c", "d"}));
+  EXPECT_EQ(queue3.front(), "e");
+}
+
+TEST(Modifiers, drain) {
+  std::vector<int> values{1, 2, 3, 4, 5};
+  sc::queue<int> queue1;
+  queue1.push_range(values.begin(), values.end());
+  std::vector<int> drained;
+  EXPECT_EQ(queue1.drain([&drained](int value) { drained.push_back(value); }),
+            5);
+  EXPECT_EQ(drained, values);
+  EXPECT_TRUE(queue1.empty());
+
+  // The elements given to a throwing callback are removed, the rest kept.
+  auto picky = [](int value) {
+    if (value == 3) {
+      throw std::invalid_argument("three");
+    }
+  };
+  queue1.push_range(values.begin(), values.end());
+  EXPECT_THROW(queue1.drain(picky), std::invalid_argument);
+  ASSERT_EQ(queue1.size(), 2);
+  EXPECT_EQ(queue1.front(), 4);
+
+  sc::queue<int, minimal_deque<int>> queue2;
+  queue2.push_range(values.begin(), values.end());
+  EXPECT_THROW(queue2.drain(picky), std::invalid_argument);
+  ASSERT_EQ(queue2.size(), 2);
+  EXPECT_EQ(queue2.front(), 4);
+  drained.clear();
+  EXPECT_EQ(queue2.drain([&drained](int value) { drained.push_back(value); }),
+            2);
+  EXPECT_EQ(drained, (std::vector<int>{4, 5}));
+}
+
 int main(int argc, char *argv[]) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
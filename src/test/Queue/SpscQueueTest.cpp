@@ -0,0 +1,170 @@
+#include "Queue/SpscQueue.h"
+#include "gtest/gtest.h"
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * There is no lock-free queue in "std", so the tests use the "sc" namespace
+ * directly. Apart from the last ones, the tests run on a single thread, which
+ * plays both the producer and the consumer.
+ */
+
+TEST(SpecialFunctions, DefaultConstructor) {
+  sc::spsc_queue<int, 8> queue;
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.size(), 0);
+  EXPECT_EQ(queue.capacity(), 8);
+}
+
+TEST(SpecialFunctions, Destructor) {
+  auto shared = std::make_shared<int>(5);
+  {
+    sc::spsc_queue<std::shared_ptr<int>, 4> queue;
+    queue.push(shared);
+    queue.push(shared);
+    EXPECT_EQ(shared.use_count(), 3);
+  }
+  EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(Modifiers, PushFrontPop) {
+  sc::spsc_queue<std::string, 4> queue;
+  queue.push("a");
+  std::string value{"b"};
+  queue.push(value);
+  queue.emplace(3, 'c');
+  EXPECT_EQ(queue.size(), 3);
+  EXPECT_EQ(queue.front(), "a");
+  queue.pop();
+  EXPECT_EQ(queue.front(), "b");
+  queue.front() = "d";
+  EXPECT_EQ(queue.front(), "d");
+  queue.pop();
+  EXPECT_EQ(queue.front(), "ccc");
+  queue.pop();
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(Modifiers, FullAndEmpty) {
+  sc::spsc_queue<int, 4> queue;
+  for (int index{0}; index < 4; ++index) {
+    EXPECT_TRUE(queue.try_push(index));
+  }
+  EXPECT_FALSE(queue.try_push(4));
+  EXPECT_FALSE(queue.try_emplace(4));
+  EXPECT_EQ(queue.size(), 4);
+
+  int value{-1};
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(queue.try_push(4));
+  for (int index{1}; index <= 4; ++index) {
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, index);
+  }
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_EQ(value, 4);
+}
+
+TEST(Modifiers, WrapAround) {
+  sc::spsc_queue<int, 4> queue;
+  int value{0};
+  for (int index{0}; index < 100; ++index) {
+    queue.push(index);
+    queue.push(index + 1000);
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(value, index);
+    ASSERT_EQ(queue.front(), index + 1000);
+    queue.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(Modifiers, MoveOnlyElements) {
+  sc::spsc_queue<std::unique_ptr<int>, 2> queue;
+  queue.push(std::make_unique<int>(1));
+  queue.emplace(new int(2));
+  std::unique_ptr<int> value;
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(*value, 1);
+  EXPECT_EQ(*queue.front(), 2);
+}
+
+TEST(Modifiers, Batches) {
+  sc::spsc_queue<int, 8> queue;
+  std::vector<int> source{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto rest = queue.try_push(source.begin(), source.end());
+  EXPECT_EQ(rest, source.begin() + 8);
+  EXPECT_EQ(queue.size(), 8);
+  EXPECT_EQ(queue.try_push(rest, source.end()), rest);
+
+  std::vector<int> destiny(10, -1);
+  EXPECT_EQ(queue.try_pop(destiny.begin(), 3), 3);
+  EXPECT_EQ(destiny[2], 2);
+  EXPECT_EQ(queue.front(), 3);
+  rest = queue.try_push(rest, source.end());
+  EXPECT_EQ(rest, source.end());
+  EXPECT_EQ(queue.try_pop(destiny.begin() + 3, 20), 7);
+  EXPECT_EQ(destiny, source);
+  EXPECT_EQ(queue.try_pop(destiny.begin(), 20), 0);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(Concurrency, OneProducerOneConsumer) {
+  constexpr int total{200'000};
+  sc::spsc_queue<int, 64> queue;
+  std::thread producer([&queue] {
+    for (int index{0}; index < total; ++index) {
+      queue.push(index);
+    }
+  });
+  int expected{0};
+  int value{0};
+  while (expected < total) {
+    if (queue.try_pop(value)) {
+      ASSERT_EQ(value, expected++);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(Concurrency, Batches) {
+  constexpr int total{200'000};
+  sc::spsc_queue<std::string, 64> queue;
+  std::thread producer([&queue] {
+    std::vector<std::string> batch;
+    for (int index{0}; index < total; index += 10) {
+      batch.clear();
+      for (int offset{0}; offset < 10; ++offset) {
+        batch.push_back(std::to_string(index + offset));
+      }
+      auto first = batch.cbegin();
+      while ((first = queue.try_push(first, batch.cend())) != batch.cend()) {
+        std::this_thread::yield();
+      }
+    }
+  });
+  std::vector<std::string> received(16);
+  int expected{0};
+  while (expected < total) {
+    size_t count = queue.try_pop(received.begin(), received.size());
+    if (count == 0) {
+      std::this_thread::yield();
+    }
+    for (size_t index{0}; index < count; ++index) {
+      ASSERT_EQ(received[index], std::to_string(expected++));
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(queue.empty());
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,163 @@
+#include "Queue/StaticQueue.h"
+#include "gtest/gtest.h"
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+/*
+ * There is no fixed capacity queue in "std", so the tests use the "sc"
+ * namespace directly. The trivial elements are also tested in compile-time
+ * evaluation, through static_assert.
+ */
+
+/// Position in a grid, trivially copyable unlike std::pair.
+struct Cell {
+  int row;
+  int column;
+};
+
+/// Breadth first search over the grid of "maze", from the top left corner to
+/// the bottom right one, at compile time. Returns the length of the path.
+constexpr int shortest_path() {
+  constexpr int size{5};
+  const char maze[size][size + 1] = {"..#..", ".##.#", "....#", "#.#..",
+                                     "...#."};
+  int distance[size][size]{};
+  sc::static_queue<Cell, size * size> frontier;
+  frontier.push({0, 0});
+  distance[0][0] = 1;
+  const int moves[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+  while (!frontier.empty()) {
+    int row = frontier.front().row;
+    int column = frontier.front().column;
+    frontier.pop();
+    for (const auto &move : moves) {
+      int next_row = row + move[0];
+      int next_column = column + move[1];
+      if (next_row >= 0 && next_row < size && next_column >= 0 &&
+          next_column < size && maze[next_row][next_column] == '.' &&
+          distance[next_row][next_column] == 0) {
+        distance[next_row][next_column] = distance[row][column] + 1;
+        frontier.push({next_row, next_column});
+      }
+    }
+  }
+  return distance[size - 1][size - 1] - 1;
+}
+
+/// Wraps around the ring, returning the state of a copy of the queue.
+constexpr std::pair<int, int> wrapped() {
+  sc::static_queue<int, 3> queue;
+  for (int value{0}; value < 10; ++value) {
+    queue.push(value);
+    if (queue.full()) {
+      queue.pop();
+    }
+  }
+  sc::static_queue<int, 3> copy = queue;
+  queue.pop();
+  return {copy.front(), copy.back()};
+}
+
+TEST(ConstantEvaluation, Evaluate) {
+  static_assert(shortest_path() == 8);
+  static_assert(wrapped() == std::pair<int, int>{8, 9});
+  static_assert(sc::static_queue<int, 3>::capacity() == 3);
+  static_assert(sc::static_queue<double, 3>().empty());
+  EXPECT_EQ(shortest_path(), 8);
+}
+
+TEST(SpecialFunctions, DefaultConstructor) {
+  sc::static_queue<int, 4> queue1;
+  EXPECT_TRUE(queue1.empty());
+  EXPECT_FALSE(queue1.full());
+  EXPECT_EQ(queue1.size(), 0);
+  EXPECT_EQ(queue1.capacity(), 4);
+
+  sc::static_queue<std::string, 4> queue2;
+  EXPECT_TRUE(queue2.empty());
+  EXPECT_EQ(queue2.size(), 0);
+}
+
+TEST(SpecialFunctions, CopyAndMove) {
+  sc::static_queue<std::string, 3> queue1;
+  // Leaves the elements wrapped around the end of the ring.
+  queue1.push("x");
+  queue1.push("y");
+  queue1.pop();
+  queue1.pop();
+  queue1.push("a");
+  queue1.push("b");
+  queue1.push(std::string(40, 'c'));
+  sc::static_queue<std::string, 3> queue2(queue1);
+  EXPECT_EQ(queue2.size(), 3);
+  EXPECT_EQ(queue2.front(), "a");
+  EXPECT_EQ(queue2.back(), std::string(40, 'c'));
+  queue2.pop();
+  EXPECT_EQ(queue1.front(), "a");
+
+  sc::static_queue<std::string, 3> queue3(std::move(queue1));
+  EXPECT_EQ(queue3.front(), "a");
+  EXPECT_EQ(queue3.back(), std::string(40, 'c'));
+  queue2 = queue3;
+  EXPECT_EQ(queue2.size(), 3);
+  EXPECT_EQ(queue2.front(), "a");
+  queue3.pop();
+  queue2 = std::move(queue3);
+  EXPECT_EQ(queue2.size(), 2);
+  EXPECT_EQ(queue2.front(), "b");
+  queue2.push("d");
+  EXPECT_EQ(queue2.back(), "d");
+}
+
+TEST(SpecialFunctions, Destructor) {
+  auto shared = std::make_shared<int>(1);
+  {
+    sc::static_queue<std::shared_ptr<int>, 2> queue;
+    queue.push(shared);
+    queue.push(shared);
+    queue.pop();
+    queue.push(shared);
+    EXPECT_EQ(shared.use_count(), 3);
+  }
+  EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(Modifiers, PushAndPop) {
+  sc::static_queue<int, 5> queue;
+  int next_in{0};
+  int next_out{0};
+  for (int round{0}; round < 20; ++round) {
+    while (!queue.full()) {
+      queue.push(next_in++);
+      EXPECT_EQ(queue.back(), next_in - 1);
+    }
+    EXPECT_THROW(queue.push(next_in), std::length_error);
+    for (int counter{0}; counter < 3; ++counter) {
+      EXPECT_EQ(queue.front(), next_out++);
+      queue.pop();
+    }
+    EXPECT_EQ(queue.size(), 2);
+  }
+}
+
+TEST(Modifiers, NonTrivialElements) {
+  sc::static_queue<std::unique_ptr<int>, 2> queue1;
+  queue1.push(std::make_unique<int>(1));
+  auto &inserted = queue1.emplace(new int(2));
+  EXPECT_EQ(&inserted, &queue1.back());
+  EXPECT_THROW(queue1.emplace(nullptr), std::length_error);
+  EXPECT_EQ(*queue1.front(), 1);
+  queue1.pop();
+  EXPECT_EQ(*queue1.front(), 2);
+
+  sc::static_queue<std::pair<int, std::string>, 2> queue2;
+  queue2.emplace(1, "one");
+  EXPECT_EQ(queue2.front().second, "one");
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
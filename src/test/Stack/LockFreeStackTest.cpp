@@ -0,0 +1,174 @@
+#include "Stack/LockFreeStack.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * There is no lock-free stack in "std", so the tests use the "sc" namespace
+ * directly. The first tests run on a single thread, the last ones check that
+ * with many threads pushing and popping every element is received exactly
+ * once, and that the removed nodes are deleted while the stack is in use.
+ */
+
+/// Element that counts how many instances of it are alive.
+struct Counted {
+  static std::atomic<int> alive;
+  explicit Counted(int number) : value{number} { ++alive; }
+  Counted(const Counted &other) : value{other.value} { ++alive; }
+  Counted &operator=(const Counted &) = default;
+  ~Counted() { --alive; }
+  int value;
+};
+std::atomic<int> Counted::alive{0};
+
+TEST(SpecialFunctions, DefaultConstructor) {
+  sc::lock_free_stack<int> stack;
+  EXPECT_TRUE(stack.empty());
+  int value{-1};
+  EXPECT_FALSE(stack.try_pop(value));
+  EXPECT_EQ(value, -1);
+}
+
+TEST(SpecialFunctions, Destructor) {
+  auto shared = std::make_shared<int>(5);
+  {
+    sc::lock_free_stack<std::shared_ptr<int>> stack;
+    stack.push(shared);
+    stack.push(shared);
+    std::shared_ptr<int> value;
+    EXPECT_TRUE(stack.try_pop(value));
+    stack.push(shared);
+    EXPECT_EQ(shared.use_count(), 4);
+  }
+  EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(Modifiers, PushAndPop) {
+  sc::lock_free_stack<std::string> stack;
+  stack.push("a");
+  std::string value{"b"};
+  stack.push(value);
+  stack.emplace(3, 'c');
+  EXPECT_FALSE(stack.empty());
+  EXPECT_TRUE(stack.try_pop(value));
+  EXPECT_EQ(value, "ccc");
+  EXPECT_TRUE(stack.try_pop(value));
+  EXPECT_EQ(value, "b");
+  EXPECT_TRUE(stack.try_pop(value));
+  EXPECT_EQ(value, "a");
+  EXPECT_TRUE(stack.empty());
+  EXPECT_FALSE(stack.try_pop(value));
+  EXPECT_EQ(value, "a");
+}
+
+TEST(Modifiers, MoveOnlyElements) {
+  sc::lock_free_stack<std::unique_ptr<int>> stack;
+  stack.push(std::make_unique<int>(1));
+  stack.emplace(new int{2});
+  std::unique_ptr<int> value;
+  EXPECT_TRUE(stack.try_pop(value));
+  EXPECT_EQ(*value, 2);
+  EXPECT_TRUE(stack.try_pop(value));
+  EXPECT_EQ(*value, 1);
+}
+
+TEST(Reclamation, RemovedNodesAreDeleted) {
+  {
+    // With 4 hazard slots the nodes are reclaimed every 8 removals.
+    sc::lock_free_stack<Counted, 4> stack;
+    Counted value{0};
+    for (int index{0}; index < 1000; ++index) {
+      stack.emplace(index);
+      ASSERT_TRUE(stack.try_pop(value));
+      ASSERT_EQ(value.value, index);
+      ASSERT_LE(Counted::alive, 1 + 8);
+    }
+  }
+  EXPECT_EQ(Counted::alive, 0);
+}
+
+TEST(Concurrency, SharedFreeList) {
+  // More threads than hazard slots, so some wait for a slot.
+  constexpr int threads_count{8};
+  constexpr int rounds{20'000};
+  constexpr int elements{64};
+  sc::lock_free_stack<int, 2> stack;
+  for (int index{0}; index < elements; ++index) {
+    stack.push(index);
+  }
+  std::vector<std::thread> threads;
+  for (int thread{0}; thread < threads_count; ++thread) {
+    threads.emplace_back([&stack] {
+      int value{0};
+      for (int round{0}; round < rounds; ++round) {
+        if (stack.try_pop(value)) {
+          stack.push(value);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  // Every element taken from the free list was given back exactly once.
+  std::vector<int> all;
+  int value{0};
+  while (stack.try_pop(value)) {
+    all.push_back(value);
+  }
+  std::sort(all.begin(), all.end());
+  ASSERT_EQ(all.size(), elements);
+  for (int index{0}; index < elements; ++index) {
+    ASSERT_EQ(all[index], index);
+  }
+}
+
+TEST(Concurrency, ManyPushersManyPoppers) {
+  constexpr int pushers{4};
+  constexpr int poppers{4};
+  constexpr int per_pusher{50'000};
+  sc::lock_free_stack<int> stack;
+  std::vector<std::thread> threads;
+  for (int pusher{0}; pusher < pushers; ++pusher) {
+    threads.emplace_back([&stack, pusher] {
+      for (int index{0}; index < per_pusher; ++index) {
+        stack.push(pusher * per_pusher + index);
+      }
+    });
+  }
+  std::vector<std::vector<int>> received(poppers);
+  for (int popper{0}; popper < poppers; ++popper) {
+    threads.emplace_back([&stack, &received, popper] {
+      int value{0};
+      while (received[popper].size() < pushers * per_pusher / poppers) {
+        if (stack.try_pop(value)) {
+          received[popper].push_back(value);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  std::vector<int> all;
+  for (auto &values : received) {
+    all.insert(all.end(), values.begin(), values.end());
+  }
+  std::sort(all.begin(), all.end());
+  ASSERT_EQ(all.size(), pushers * per_pusher);
+  for (int index{0}; index < pushers * per_pusher; ++index) {
+    ASSERT_EQ(all[index], index);
+  }
+  EXPECT_TRUE(stack.empty());
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
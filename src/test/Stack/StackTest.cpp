@@ -1,15 +1,23 @@
+#include "../Adapter/MinimalDeque.h"
 #include "Stack/Stack.h"
 #include "gtest/gtest.h"
 #include <initializer_list>
+#include <iterator>
 #include <list>
+#include <memory>
+#include <sstream>
 #include <stack>
+#include <stdexcept>
+#include <string>
+#include <utility>
 #include <vector>
 
 /*
  * The "lib" macro can be used to select which lib to test. To ensure the
  * integrity of the tests, the "std" namespace must be used, to effectively test
- * the vector developed the "sc" namespace must be used. Note: the test for the
- * range constructor does not use the "lib" macro, because it is incompatible
+ * the vector developed the "sc" namespace must be used. Note: the tests for the
+ * range constructor, for "reserve" and for the batch functions (push_range,
+ * pop_n and drain) do not use the "lib" macro, because they are incompatible
  * with the standard library, instead the namespace "sc" is used directly.
  */
 #define lib sc
@@ -126,6 +134,34 @@ TEST(SpecialFunctions, AssignOperator) {
   EXPECT_EQ(stack3_copy.size(), stack3.size());
 }
 
+TEST(SpecialFunctions, CopyAndMoveAssignment) {
+  lib::stack<std::string> stack1;
+  stack1.push("a");
+  stack1.push("b");
+  stack1.push("c");
+  lib::stack<std::string> stack2;
+  stack2.push("d");
+  stack2 = stack1;
+  EXPECT_EQ(stack2.size(), 3);
+  EXPECT_EQ(stack2.top(), "c");
+  stack2.pop();
+  EXPECT_EQ(stack1.top(), "c");
+
+  lib::stack<std::string> stack3;
+  stack3 = std::move(stack2);
+  EXPECT_EQ(stack3.size(), 2);
+  EXPECT_EQ(stack3.top(), "b");
+  lib::stack<std::string> stack4(std::move(stack3));
+  EXPECT_EQ(stack4.size(), 2);
+  EXPECT_EQ(stack4.top(), "b");
+
+  std::initializer_list<int> ilist1{1, 2};
+  lib::stack<int, std::list<int>> stack5(ilist1);
+  lib::stack<int, std::list<int>> stack6;
+  stack6 = stack5;
+  EXPECT_EQ(stack6.top(), 2);
+}
+
 TEST(ElementAccess, top) {
   std::initializer_list<int> ilist1{1, 2, 3, 4};
   lib::stack<int> stack1(ilist1);
@@ -161,6 +197,22 @@ TEST(Capacity, size) {
   EXPECT_EQ(stack3.size(), 0);
 }
 
+TEST(Capacity, reserve) {
+  sc::stack<int> stack1;
+  stack1.reserve(100);
+  stack1.push(1);
+  const int *address = &stack1.top();
+  for (int counter{2}; counter <= 100; ++counter) {
+    stack1.push(counter);
+  }
+  for (int counter{100}; counter > 1; --counter) {
+    stack1.pop();
+  }
+  // Reserved storage means the elements were never reallocated.
+  EXPECT_EQ(&stack1.top(), address);
+  EXPECT_EQ(stack1.top(), 1);
+}
+
 TEST(Modifiers, push) {
   lib::stack<int> stack1;
   for (int counter{0}; counter < 9; ++counter) {
@@ -175,6 +227,30 @@ TEST(Modifiers, push) {
   }
 }
 
+TEST(Modifiers, PushRvalue) {
+  lib::stack<std::unique_ptr<int>> stack1;
+  for (int counter{0}; counter < 9; ++counter) {
+    auto pointer = std::make_unique<int>(counter);
+    stack1.push(std::move(pointer));
+    EXPECT_EQ(pointer, nullptr);
+    EXPECT_EQ(*stack1.top(), counter);
+  }
+  EXPECT_EQ(stack1.size(), 9);
+}
+
+TEST(Modifiers, emplace) {
+  lib::stack<std::pair<int, std::string>> stack1;
+  for (int counter{0}; counter < 9; ++counter) {
+    auto &inserted = stack1.emplace(counter, "value");
+    EXPECT_EQ(inserted.first, counter);
+    EXPECT_EQ(&inserted, &stack1.top());
+  }
+
+  lib::stack<std::string, std::list<std::string>> stack2;
+  stack2.emplace(3, 'a');
+  EXPECT_EQ(stack2.top(), "aaa");
+}
+
 TEST(Modifiers, pop) {
   std::initializer_list<int> ilist1{1, 2, 3, 4, 5};
   lib::stack<int> stack1(ilist1);
@@ -192,6 +268,86 @@ TEST(Modifiers, pop) {
   }
 }
 
+TEST(Modifiers, push_range) {
+  std::vector<int> values{1, 2, 3, 4, 5};
+  sc::stack<int> stack1;
+  stack1.push(0);
+  stack1.push_range(values.begin(), values.end());
+  stack1.push_range(values.end(), values.end());
+  ASSERT_EQ(stack1.size(), 6);
+  for (int counter{5}; counter >= 0; --counter) {
+    EXPECT_EQ(stack1.top(), counter);
+    stack1.pop();
+  }
+
+  // Input iterators and containers without range insert push one by one.
+  std::istringstream input("1 2 3");
+  sc::stack<int, minimal_deque<int>> stack2;
+  stack2.push_range(std::istream_iterator<int>(input),
+                    std::istream_iterator<int>());
+  ASSERT_EQ(stack2.size(), 3);
+  EXPECT_EQ(stack2.top(), 3);
+}
+
+TEST(Modifiers, pop_n) {
+  std::vector<std::string> values{"a", "b", "c", "d", "e"};
+  sc::stack<std::string> stack1;
+  stack1.push_range(values.begin(), values.end());
+  std::vector<std::string> popped;
+  EXPECT_EQ(stack1.pop_n(std::back_inserter(popped), 2), 2);
+  EXPECT_EQ(popped, (std::vector<std::string>{"e", "d"}));
+  EXPECT_EQ(stack1.top(), "c");
+  EXPECT_EQ(stack1.pop_n(std::back_inserter(popped), 10), 3);
+  EXPECT_EQ(popped, (std::vector<std::string>{"e", "d", "c", "b", "a"}));
+  EXPECT_TRUE(stack1.empty());
+  EXPECT_EQ(stack1.pop_n(std::back_inserter(popped), 10), 0);
+
+  sc::stack<std::string, std::list<std::string>> stack2;
+  stack2.push_range(values.begin(), values.end());
+  std::vector<std::string> buffer(4);
+  EXPECT_EQ(stack2.pop_n(buffer.begin(), 4), 4);
+  EXPECT_EQ(buffer, (std::vector<std::string>{"e", "d", "c", "b"}));
+  EXPECT_EQ(stack2.size(), 1);
+
+  sc::stack<std::string, minimal_deque<std::string>> stack3;
+  stack3.push_range(values.begin(), values.end());
+  EXPECT_EQ(stack3.pop_n(buffer.begin(), 4), 4);
+  EXPECT_EQ(buffer, (std::vector<std::string>{"e", "d", "c", "b"}));
+  EXPECT_EQ(stack3.top(), "a");
+}
+
+TEST(Modifiers, drain) {
+  std::vector<int> values{1, 2, 3, 4, 5};
+  sc::stack<int> stack1;
+  stack1.push_range(values.begin(), values.end());
+  std::vector<int> drained;
+  EXPECT_EQ(stack1.drain([&drained](int value) { drained.push_back(value); }),
+            5);
+  EXPECT_EQ(drained, (std::vector<int>{5, 4, 3, 2, 1}));
+  EXPECT_TRUE(stack1.empty());
+
+  // The elements given to a throwing callback are removed, the rest kept.
+  auto picky = [](int value) {
+    if (value == 3) {
+      throw std::invalid_argument("three");
+    }
+  };
+  stack1.push_range(values.begin(), values.end());
+  EXPECT_THROW(stack1.drain(picky), std::invalid_argument);
+  ASSERT_EQ(stack1.size(), 2);
+  EXPECT_EQ(stack1.top(), 2);
+
+  sc::stack<int, minimal_deque<int>> stack2;
+  stack2.push_range(values.begin(), values.end());
+  EXPECT_THROW(stack2.drain(picky), std::invalid_argument);
+  ASSERT_EQ(stack2.size(), 2);
+  EXPECT_EQ(stack2.top(), 2);
+  drained.clear();
+  EXPECT_EQ(stack2.drain([&drained](int value) { drained.push_back(value); }),
+            2);
+  EXPECT_EQ(drained, (std::vector<int>{2, 1}));
+}
+
 int main(int argc, char *argv[]) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
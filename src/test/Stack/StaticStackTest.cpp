@@ -0,0 +1,134 @@
+#include "Stack/StaticStack.h"
+#include "gtest/gtest.h"
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+/*
+ * There is no fixed capacity stack in "std", so the tests use the "sc"
+ * namespace directly. The trivial elements are also tested in compile-time
+ * evaluation, through static_assert.
+ */
+
+/// Evaluates "1 2 + 3 * 4 -", in reverse polish notation, at compile time.
+constexpr int evaluate() {
+  sc::static_stack<int, 4> stack;
+  const char expression[] = "12+3*4-";
+  for (char token : expression) {
+    if (token >= '0' && token <= '9') {
+      stack.push(token - '0');
+    } else if (token != '\0') {
+      int right = stack.top();
+      stack.pop();
+      int left = stack.top();
+      stack.pop();
+      stack.push(token == '+' ? left + right
+                 : token == '-' ? left - right
+                                : left * right);
+    }
+  }
+  return stack.top();
+}
+
+/// Pushes and pops a few values, returning the state of a copy of the stack.
+constexpr std::pair<size_t, int> copied() {
+  sc::static_stack<int, 8> stack;
+  for (int value{1}; value <= 5; ++value) {
+    stack.emplace(value);
+  }
+  stack.pop();
+  sc::static_stack<int, 8> copy = stack;
+  stack.pop();
+  return {copy.size(), copy.top()};
+}
+
+TEST(ConstantEvaluation, Evaluate) {
+  static_assert(evaluate() == 5);
+  static_assert(copied() == std::pair<size_t, int>{4, 4});
+  static_assert(sc::static_stack<int, 3>::capacity() == 3);
+  static_assert(sc::static_stack<double, 3>().empty());
+  EXPECT_EQ(evaluate(), 5);
+}
+
+TEST(SpecialFunctions, DefaultConstructor) {
+  sc::static_stack<int, 4> stack1;
+  EXPECT_TRUE(stack1.empty());
+  EXPECT_FALSE(stack1.full());
+  EXPECT_EQ(stack1.size(), 0);
+  EXPECT_EQ(stack1.capacity(), 4);
+
+  sc::static_stack<std::string, 4> stack2;
+  EXPECT_TRUE(stack2.empty());
+  EXPECT_EQ(stack2.size(), 0);
+}
+
+TEST(SpecialFunctions, CopyAndMove) {
+  sc::static_stack<std::string, 4> stack1;
+  stack1.push("a");
+  stack1.push(std::string(40, 'b'));
+  sc::static_stack<std::string, 4> stack2(stack1);
+  EXPECT_EQ(stack2.size(), 2);
+  EXPECT_EQ(stack2.top(), std::string(40, 'b'));
+  stack2.pop();
+  EXPECT_EQ(stack1.size(), 2);
+
+  sc::static_stack<std::string, 4> stack3(std::move(stack1));
+  EXPECT_EQ(stack3.top(), std::string(40, 'b'));
+  stack2 = stack3;
+  EXPECT_EQ(stack2.size(), 2);
+  EXPECT_EQ(stack2.top(), std::string(40, 'b'));
+  stack3.pop();
+  stack2 = std::move(stack3);
+  EXPECT_EQ(stack2.size(), 1);
+  EXPECT_EQ(stack2.top(), "a");
+}
+
+TEST(SpecialFunctions, Destructor) {
+  auto shared = std::make_shared<int>(1);
+  {
+    sc::static_stack<std::shared_ptr<int>, 4> stack;
+    stack.push(shared);
+    stack.push(shared);
+    stack.push(shared);
+    stack.pop();
+    EXPECT_EQ(shared.use_count(), 3);
+  }
+  EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(Modifiers, PushAndPop) {
+  sc::static_stack<int, 16> stack;
+  for (int counter{0}; counter < 16; ++counter) {
+    stack.push(counter);
+    EXPECT_EQ(stack.top(), counter);
+  }
+  EXPECT_TRUE(stack.full());
+  EXPECT_THROW(stack.push(16), std::length_error);
+  EXPECT_EQ(stack.size(), 16);
+  for (int counter{15}; counter >= 0; --counter) {
+    EXPECT_EQ(stack.top(), counter);
+    stack.pop();
+  }
+  EXPECT_TRUE(stack.empty());
+}
+
+TEST(Modifiers, NonTrivialElements) {
+  sc::static_stack<std::unique_ptr<int>, 2> stack1;
+  stack1.push(std::make_unique<int>(1));
+  auto &inserted = stack1.emplace(new int(2));
+  EXPECT_EQ(&inserted, &stack1.top());
+  EXPECT_EQ(*stack1.top(), 2);
+  EXPECT_THROW(stack1.emplace(nullptr), std::length_error);
+  stack1.pop();
+  EXPECT_EQ(*stack1.top(), 1);
+
+  sc::static_stack<std::pair<int, std::string>, 2> stack2;
+  stack2.emplace(1, "one");
+  EXPECT_EQ(stack2.top().second, "one");
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,166 @@
+#include "Vector/MappedVector.h"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+/*
+ * There is no mapped_vector in "std", so the tests use the "sc" namespace
+ * directly. Every test works on its own file in the temporary directory, which
+ * is removed in the end.
+ */
+
+/// Path of a temporary file, which is removed when the object is destroyed.
+class TemporaryFile {
+public:
+  explicit TemporaryFile(const std::string &name)
+      : m_path{(std::filesystem::temp_directory_path() /
+                ("sc_mapped_vector_" + name))
+                   .string()} {
+    std::remove(m_path.c_str());
+  }
+  ~TemporaryFile() { std::remove(m_path.c_str()); }
+  const std::string &path() const { return m_path; }
+
+private:
+  std::string m_path;
+};
+
+TEST(SpecialFunctions, Create) {
+  TemporaryFile file("create");
+  sc::mapped_vector<int> list1(file.path());
+  EXPECT_TRUE(list1.empty());
+  EXPECT_EQ(list1.size(), 0);
+  EXPECT_GT(list1.capacity(), 0);
+  EXPECT_FALSE(list1.read_only());
+}
+
+TEST(SpecialFunctions, Reopen) {
+  TemporaryFile file("reopen");
+  {
+    sc::mapped_vector<uint64_t> list1(file.path());
+    for (uint64_t counter{0}; counter < 100'000; ++counter) {
+      list1.push_back(counter);
+    }
+  }
+  sc::mapped_vector<uint64_t> list2(file.path());
+  ASSERT_EQ(list2.size(), 100'000);
+  EXPECT_EQ(list2[12345], 12345);
+  list2.push_back(7);
+  EXPECT_EQ(list2.back(), 7);
+}
+
+TEST(SpecialFunctions, ReadOnly) {
+  TemporaryFile file("read_only");
+  {
+    sc::mapped_vector<double> list1(file.path());
+    list1.resize(1000, 0.5);
+    list1.flush();
+  }
+  const sc::mapped_vector<double> list2(
+      file.path(), sc::mapped_vector<double>::mode::read_only);
+  EXPECT_TRUE(list2.read_only());
+  EXPECT_EQ(list2.size(), 1000);
+  EXPECT_EQ(std::accumulate(list2.begin(), list2.end(), 0.0), 500.0);
+
+  sc::mapped_vector<double> list3(file.path(),
+                                  sc::mapped_vector<double>::mode::read_only);
+  EXPECT_THROW(list3.reserve(1'000'000), std::logic_error);
+}
+
+TEST(SpecialFunctions, InvalidFile) {
+  TemporaryFile file("invalid");
+  EXPECT_THROW(sc::mapped_vector<int>(file.path(),
+                                      sc::mapped_vector<int>::mode::read_only),
+               std::system_error);
+  {
+    sc::mapped_vector<int> list1(file.path());
+    list1.push_back(1);
+  }
+  EXPECT_THROW(sc::mapped_vector<double>{file.path()}, std::runtime_error);
+}
+
+TEST(SpecialFunctions, InvalidSize) {
+  TemporaryFile file("invalid_size");
+  {
+    sc::mapped_vector<int> list1(file.path());
+    list1.push_back(1);
+  }
+  // Overwrites the size in the header, after the magic and the element size.
+  {
+    std::fstream stream(file.path(),
+                        std::ios::in | std::ios::out | std::ios::binary);
+    const uint64_t size{1'000'000'000};
+    stream.seekp(2 * sizeof(uint64_t));
+    stream.write(reinterpret_cast<const char *>(&size), sizeof(size));
+  }
+  EXPECT_THROW(sc::mapped_vector<int>{file.path()}, std::runtime_error);
+}
+
+TEST(SpecialFunctions, Move) {
+  TemporaryFile file("move");
+  sc::mapped_vector<int> list1(file.path());
+  list1.push_back(42);
+  sc::mapped_vector<int> list2(std::move(list1));
+  EXPECT_EQ(list2[0], 42);
+  list2.push_back(43);
+  EXPECT_EQ(list2.size(), 2);
+}
+
+TEST(Capacity, ReserveAndShrink) {
+  TemporaryFile file("capacity");
+  sc::mapped_vector<int> list1(file.path());
+  list1.push_back(1);
+  list1.reserve(100'000);
+  EXPECT_GE(list1.capacity(), 100'000);
+  EXPECT_EQ(list1[0], 1);
+  EXPECT_GE(std::filesystem::file_size(file.path()), 400'000);
+  list1.shrink_to_fit();
+  EXPECT_LT(list1.capacity(), 100'000);
+  EXPECT_EQ(list1[0], 1);
+}
+
+TEST(Modifiers, PushBackAndPopBack) {
+  TemporaryFile file("modifiers");
+  sc::mapped_vector<int> list1(file.path());
+  for (int counter{0}; counter < 5000; ++counter) {
+    list1.push_back(counter);
+  }
+  EXPECT_EQ(list1.size(), 5000);
+  for (int counter{0}; counter < 5000; ++counter) {
+    EXPECT_EQ(list1[counter], counter);
+  }
+  list1.pop_back();
+  EXPECT_EQ(list1.back(), 4998);
+  list1.emplace_back(-1);
+  EXPECT_EQ(list1.back(), -1);
+  list1.clear();
+  EXPECT_TRUE(list1.empty());
+}
+
+TEST(Modifiers, InsertOwnElement) {
+  TemporaryFile file("own_element");
+  sc::mapped_vector<int> list1(file.path());
+  list1.push_back(7);
+  while (list1.size() < list1.capacity()) {
+    list1.push_back(static_cast<int>(list1.size()));
+  }
+  // Both elements given must survive the new mapping of the file.
+  const int last = list1.back();
+  list1.push_back(list1.back());
+  EXPECT_EQ(list1.back(), last);
+  list1.resize(list1.capacity() + 1, list1[0]);
+  EXPECT_EQ(list1.back(), 7);
+  EXPECT_EQ(list1[0], 7);
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,193 @@
+#include "Vector/ParallelAlgorithms.h"
+#include "Vector/Vector.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+/*
+ * There are no parallel algorithms with a thread count in "std", so the tests
+ * use the "sc" namespace directly and compare the results with the serial std
+ * algorithms. Every test runs with several pool sizes, including ones that do
+ * not divide the sizes of the ranges, and the ranges are large enough to be
+ * split among the threads.
+ */
+
+namespace parallel = sc::parallel;
+
+/// Pool sizes to run every test with.
+static const size_t thread_counts[]{1, 2, 3, 4, 7};
+
+/// Size of the ranges, split in up to 7 slices of the minimum grain.
+static const size_t large{7 * parallel::detail::GRAIN + 13};
+
+static sc::vector<int> random_values(size_t size) {
+  std::mt19937 generator(static_cast<unsigned>(size));
+  std::uniform_int_distribution<int> distribution(-1000, 1000);
+  sc::vector<int> result;
+  for (size_t index{0}; index < size; ++index) {
+    result.push_back(distribution(generator));
+  }
+  return result;
+}
+
+/// Counts its live instances, and throws when copied after a given number.
+struct Tracked {
+  static std::atomic<int> live;
+  static std::atomic<int> copies_left;
+  int value{0};
+
+  Tracked(int init) : value{init} { ++live; }
+  Tracked(const Tracked &other) : value{other.value} {
+    if (--copies_left < 0) {
+      throw std::runtime_error("copy failed");
+    }
+    ++live;
+  }
+  ~Tracked() { --live; }
+};
+std::atomic<int> Tracked::live{0};
+std::atomic<int> Tracked::copies_left{0};
+
+TEST(ThreadPool, run) {
+  for (size_t threads : thread_counts) {
+    parallel::thread_pool pool(threads);
+    EXPECT_EQ(pool.size(), threads);
+    for (size_t tasks : {0, 1, 5, 100}) {
+      auto calls = std::make_unique<std::atomic<int>[]>(tasks);
+      pool.run(tasks, [&](size_t index) { ++calls[index]; });
+      for (size_t index{0}; index < tasks; ++index) {
+        EXPECT_EQ(calls[index], 1);
+      }
+    }
+  }
+  parallel::thread_pool pool(0);
+  EXPECT_EQ(pool.size(), 1);
+}
+
+TEST(ThreadPool, exception) {
+  parallel::thread_pool pool(4);
+  EXPECT_THROW(pool.run(64,
+                        [](size_t index) {
+                          if (index == 3) {
+                            throw std::runtime_error("task failed");
+                          }
+                        }),
+               std::runtime_error);
+  // The pool is still usable after a failed job.
+  std::atomic<size_t> total{0};
+  pool.run(64, [&](size_t index) { total += index; });
+  EXPECT_EQ(total, 64 * 63 / 2);
+}
+
+TEST(Algorithms, fill) {
+  for (size_t threads : thread_counts) {
+    parallel::thread_pool pool(threads);
+    sc::vector<int> list1(large, 0);
+    parallel::fill(pool, list1.begin(), list1.end(), 7);
+    EXPECT_EQ(std::count(list1.begin(), list1.end(), 7), large);
+    parallel::fill(pool, list1.begin() + 1, list1.begin() + 3, 8);
+    EXPECT_EQ(list1[0], 7);
+    EXPECT_EQ(list1[2], 8);
+    EXPECT_EQ(list1[3], 7);
+  }
+}
+
+TEST(Algorithms, transform) {
+  for (size_t threads : thread_counts) {
+    parallel::thread_pool pool(threads);
+    auto list1 = random_values(large);
+    sc::vector<long> list2(large, 0);
+    auto end = parallel::transform(pool, list1.begin(), list1.end(),
+                                   list2.begin(),
+                                   [](int value) { return value * 2L; });
+    EXPECT_EQ(end, list2.end());
+    for (size_t index{0}; index < large; ++index) {
+      EXPECT_EQ(list2[index], list1[index] * 2L);
+    }
+  }
+}
+
+TEST(Algorithms, assign) {
+  for (size_t threads : thread_counts) {
+    parallel::thread_pool pool(threads);
+    auto list1 = random_values(large);
+    sc::vector<int> list2{1, 2, 3};
+    parallel::assign(pool, list2, list1.begin(), list1.end());
+    EXPECT_TRUE(std::equal(list1.begin(), list1.end(), list2.begin(),
+                           list2.end()));
+
+    parallel::append(pool, list2, list1.begin(), list1.begin() + 10);
+    EXPECT_EQ(list2.size(), large + 10);
+    EXPECT_EQ(list2[large + 9], list1[9]);
+
+    sc::vector<std::string> list3;
+    parallel::assign(pool, list3, large, std::string("exemple"));
+    EXPECT_EQ(list3.size(), large);
+    EXPECT_EQ(std::count(list3.begin(), list3.end(), "exemple"), large);
+  }
+}
+
+TEST(Algorithms, AssignException) {
+  for (size_t threads : thread_counts) {
+    parallel::thread_pool pool(threads);
+    Tracked::copies_left = static_cast<int>(4 * large);
+    sc::vector<Tracked> list1;
+    for (size_t index{0}; index < large; ++index) {
+      list1.emplace_back(static_cast<int>(index));
+    }
+    sc::vector<Tracked> list2;
+    list2.emplace_back(-1);
+    Tracked::copies_left = static_cast<int>(large / 2);
+    EXPECT_THROW(parallel::append(pool, list2, list1.begin(), list1.end()),
+                 std::runtime_error);
+    // None of the copies is left alive, and the vector is unchanged.
+    EXPECT_EQ(list2.size(), 1);
+    EXPECT_EQ(list2[0].value, -1);
+    EXPECT_EQ(Tracked::live, static_cast<int>(large) + 1);
+  }
+  EXPECT_EQ(Tracked::live, 0);
+}
+
+TEST(Algorithms, sort) {
+  for (size_t threads : thread_counts) {
+    parallel::thread_pool pool(threads);
+    for (size_t size : {size_t{0}, size_t{1}, size_t{1000}, large}) {
+      auto list1 = random_values(size);
+      auto list2 = list1;
+      parallel::sort(pool, list1.begin(), list1.end());
+      std::sort(list2.begin(), list2.end());
+      EXPECT_TRUE(std::equal(list1.begin(), list1.end(), list2.begin(),
+                             list2.end()));
+
+      parallel::sort(pool, list1.data(), list1.data() + size,
+                     std::greater<>());
+      std::sort(list2.begin(), list2.end(), std::greater<>());
+      EXPECT_TRUE(std::equal(list1.begin(), list1.end(), list2.begin(),
+                             list2.end()));
+    }
+  }
+}
+
+TEST(Algorithms, SortNonTrivial) {
+  parallel::thread_pool pool(4);
+  auto values = random_values(large);
+  sc::vector<std::string> list1;
+  for (int value : values) {
+    list1.push_back(std::to_string(value));
+  }
+  auto list2 = list1;
+  parallel::sort(pool, list1.begin(), list1.end());
+  std::sort(list2.begin(), list2.end());
+  EXPECT_TRUE(std::equal(list1.begin(), list1.end(), list2.begin(),
+                         list2.end()));
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,182 @@
+#include "Vector/SimdAlgorithms.h"
+#include "Vector/Span.h"
+#include "Vector/Vector.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+/*
+ * There are no vectorized algorithms in "std", so the tests use the "sc"
+ * namespace directly and compare every instruction set the machine supports
+ * against the std algorithms. The sizes are chosen so the ranges end in every
+ * possible remainder of a SSE2 and of a AVX2 register.
+ */
+
+namespace simd = sc::simd;
+
+/// Instruction sets supported by the machine running the tests.
+static std::vector<simd::isa> supported_isas() {
+  std::vector<simd::isa> result;
+  for (simd::isa wanted : {simd::isa::scalar, simd::isa::sse2,
+                           simd::isa::avx2}) {
+    if (simd::instruction_set(wanted) == wanted) {
+      result.push_back(wanted);
+    }
+  }
+  return result;
+}
+
+template <typename T> static std::vector<T> random_values(size_t size) {
+  std::mt19937 generator(static_cast<unsigned>(size));
+  std::uniform_int_distribution<int> distribution(-50, 50);
+  std::vector<T> result(size);
+  for (auto &value : result) {
+    value = static_cast<T>(distribution(generator));
+  }
+  return result;
+}
+
+TEST(Dispatch, instruction_set) {
+  simd::isa best{simd::instruction_set(simd::isa::avx2)};
+  EXPECT_EQ(simd::instruction_set(), best);
+  EXPECT_EQ(simd::instruction_set(simd::isa::scalar), simd::isa::scalar);
+  EXPECT_EQ(simd::instruction_set(), simd::isa::scalar);
+  simd::instruction_set(simd::isa::avx2);
+}
+
+TEST(Algorithms, find) {
+  for (simd::isa current : supported_isas()) {
+    simd::instruction_set(current);
+    for (size_t size{0}; size < 40; ++size) {
+      std::vector<int32_t> list1(size, 1);
+      std::vector<float> list2(size, 1.0f);
+      EXPECT_EQ(simd::find(list1.data(), list1.data() + size, 2),
+                list1.data() + size);
+      EXPECT_EQ(simd::find(list2.data(), list2.data() + size, 2.0f),
+                list2.data() + size);
+      for (size_t pos{0}; pos < size; ++pos) {
+        list1[pos] = 2;
+        list2[pos] = 2.0f;
+        EXPECT_EQ(simd::find(list1.data(), list1.data() + size, 2),
+                  list1.data() + pos);
+        EXPECT_EQ(simd::find(list2.data(), list2.data() + size, 2.0f),
+                  list2.data() + pos);
+        list1[pos] = 1;
+        list2[pos] = 1.0f;
+      }
+    }
+  }
+  simd::instruction_set(simd::isa::avx2);
+}
+
+TEST(Algorithms, count) {
+  for (simd::isa current : supported_isas()) {
+    simd::instruction_set(current);
+    for (size_t size : {0, 1, 3, 4, 7, 8, 9, 15, 16, 17, 1000, 1003}) {
+      auto list1 = random_values<int32_t>(size);
+      auto list2 = random_values<float>(size);
+      auto list3 = random_values<int64_t>(size);
+      for (int value : {-50, 0, 7, 51}) {
+        EXPECT_EQ(simd::count(list1.data(), list1.data() + size, value),
+                  std::count(list1.begin(), list1.end(), value));
+        EXPECT_EQ(simd::count(list2.data(), list2.data() + size,
+                              static_cast<float>(value)),
+                  std::count(list2.begin(), list2.end(), value));
+        EXPECT_EQ(simd::count(list3.data(), list3.data() + size, value),
+                  std::count(list3.begin(), list3.end(), value));
+      }
+    }
+  }
+  simd::instruction_set(simd::isa::avx2);
+}
+
+TEST(Algorithms, min_max) {
+  for (simd::isa current : supported_isas()) {
+    simd::instruction_set(current);
+    for (size_t size : {1, 3, 4, 7, 8, 9, 15, 16, 17, 1000, 1003}) {
+      auto list1 = random_values<int32_t>(size);
+      auto list2 = random_values<float>(size);
+      const int32_t *first1{list1.data()};
+      const float *first2{list2.data()};
+      EXPECT_EQ(simd::min(first1, first1 + size),
+                *std::min_element(list1.begin(), list1.end()));
+      EXPECT_EQ(simd::max(first1, first1 + size),
+                *std::max_element(list1.begin(), list1.end()));
+      EXPECT_EQ(simd::min(first2, first2 + size),
+                *std::min_element(list2.begin(), list2.end()));
+      EXPECT_EQ(simd::max(first2, first2 + size),
+                *std::max_element(list2.begin(), list2.end()));
+    }
+    std::vector<int32_t> list3{INT32_MIN, -1, 0, 1, INT32_MAX,
+                               INT32_MIN, -1, 0, 1, INT32_MAX};
+    EXPECT_EQ(simd::min(list3.data(), list3.data() + list3.size()),
+              INT32_MIN);
+    EXPECT_EQ(simd::max(list3.data(), list3.data() + list3.size()),
+              INT32_MAX);
+  }
+  simd::instruction_set(simd::isa::avx2);
+}
+
+TEST(Algorithms, sum) {
+  for (simd::isa current : supported_isas()) {
+    simd::instruction_set(current);
+    for (size_t size : {0, 1, 3, 4, 7, 8, 9, 15, 16, 17, 1000, 1003}) {
+      auto list1 = random_values<int32_t>(size);
+      auto list2 = random_values<float>(size);
+      const int32_t *first1{list1.data()};
+      const float *first2{list2.data()};
+      EXPECT_EQ(simd::sum(first1, first1 + size),
+                std::accumulate(list1.begin(), list1.end(), int64_t{0}));
+      // Small integers, so the floats are added without rounding.
+      EXPECT_EQ(simd::sum(first2, first2 + size),
+                std::accumulate(list2.begin(), list2.end(), 0.0f));
+    }
+    // The lanes must be widened before adding, or this overflows.
+    std::vector<int32_t> list3(100, INT32_MAX);
+    EXPECT_EQ(simd::sum(list3.data(), list3.data() + list3.size()),
+              int64_t{INT32_MAX} * 100);
+  }
+  simd::instruction_set(simd::isa::avx2);
+}
+
+TEST(Overloads, span) {
+  sc::vector<int32_t> list1{5, 3, 8, 1, 9, 2, 7, 3, 6};
+  sc::span<int32_t> range1(list1.data(), list1.size());
+  EXPECT_EQ(simd::find(range1, 9), list1.data() + 4);
+  *simd::find(range1, 9) = 4;
+  EXPECT_EQ(list1[4], 4);
+  EXPECT_EQ(simd::count(range1, 3), 2);
+  EXPECT_EQ(simd::min(range1), 1);
+  EXPECT_EQ(simd::max(range1), 8);
+  EXPECT_EQ(simd::sum(range1), 39);
+
+  sc::span<const int32_t> range2(list1.data() + 1, 3);
+  EXPECT_EQ(simd::find(range2, 5), range2.end());
+  EXPECT_EQ(simd::min(range2), 1);
+  EXPECT_EQ(simd::sum(range2), 12);
+}
+
+TEST(Overloads, vector) {
+  sc::vector<float> list1{1.5f, -2.0f, 4.0f, 0.5f, -2.0f};
+  EXPECT_EQ(simd::find(list1, -2.0f), list1.begin() + 1);
+  EXPECT_EQ(simd::find(list1, 3.0), list1.end());
+  const auto &list2 = list1;
+  EXPECT_EQ(simd::find(list2, 0.5f), list2.cbegin() + 3);
+  EXPECT_EQ(simd::count(list1, -2.0f), 2);
+  EXPECT_EQ(simd::min(list1), -2.0f);
+  EXPECT_EQ(simd::max(list1), 4.0f);
+  EXPECT_EQ(simd::sum(list1), 2.0f);
+
+  sc::vector<int64_t> list3{3, 1, 2};
+  EXPECT_EQ(simd::find(list3, 2), list3.begin() + 2);
+  EXPECT_EQ(simd::max(list3), 3);
+  EXPECT_EQ(simd::sum(list3), 6);
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
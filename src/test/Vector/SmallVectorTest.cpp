@@ -0,0 +1,303 @@
+#include "Vector/SmallVector.h"
+#include "gtest/gtest.h"
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <utility>
+
+/*
+ * There is no small_vector in "std", so the tests use the "sc" namespace
+ * directly. Most of them check that the elements move from the inline buffer to
+ * the heap, and back, without losing any of them.
+ */
+
+TEST(SpecialFunctions, DefaultConstructor) {
+  sc::small_vector<int, 4> list1;
+  EXPECT_TRUE(list1.empty());
+  EXPECT_EQ(list1.size(), 0);
+  EXPECT_EQ(list1.capacity(), 4);
+  EXPECT_TRUE(list1.is_inline());
+
+  sc::small_vector<std::string, 4> list2(9, "exemple");
+  EXPECT_EQ(list2.size(), 9);
+  EXPECT_EQ(list2.capacity(), 9);
+  EXPECT_FALSE(list2.is_inline());
+  EXPECT_EQ(list2[8], "exemple");
+}
+
+TEST(SpecialFunctions, InitializerListConstructor) {
+  sc::small_vector<int, 8> list1{1, 2, 3};
+  EXPECT_EQ(list1.size(), 3);
+  EXPECT_TRUE(list1.is_inline());
+  EXPECT_EQ(list1[2], 3);
+
+  sc::small_vector<int, 2> list2{1, 2, 3};
+  EXPECT_EQ(list2.size(), 3);
+  EXPECT_FALSE(list2.is_inline());
+  EXPECT_EQ(list2[2], 3);
+}
+
+TEST(SpecialFunctions, CopyConstructor) {
+  sc::small_vector<std::string, 2> list1{"a", "b"};
+  sc::small_vector<std::string, 2> list2(list1);
+  EXPECT_TRUE(list2.is_inline());
+  EXPECT_EQ(list2[1], "b");
+
+  list1.push_back("c");
+  sc::small_vector<std::string, 2> list3(list1);
+  EXPECT_FALSE(list3.is_inline());
+  EXPECT_NE(list3.data(), list1.data());
+  EXPECT_EQ(list3[2], "c");
+}
+
+TEST(SpecialFunctions, MoveConstructor) {
+  sc::small_vector<std::unique_ptr<int>, 2> list1;
+  list1.push_back(std::make_unique<int>(1));
+  sc::small_vector<std::unique_ptr<int>, 2> list2(std::move(list1));
+  EXPECT_TRUE(list1.empty());
+  EXPECT_EQ(*list2[0], 1);
+
+  list2.push_back(std::make_unique<int>(2));
+  list2.push_back(std::make_unique<int>(3));
+  const auto *array = list2.data();
+  sc::small_vector<std::unique_ptr<int>, 2> list3(std::move(list2));
+  EXPECT_EQ(list3.data(), array);
+  EXPECT_TRUE(list2.empty());
+  EXPECT_TRUE(list2.is_inline());
+  EXPECT_EQ(*list3[2], 3);
+}
+
+TEST(SpecialFunctions, Assignment) {
+  sc::small_vector<int, 2> list1{1, 2, 3, 4};
+  sc::small_vector<int, 2> list2{5};
+  list2 = list1;
+  EXPECT_EQ(list2.size(), 4);
+  EXPECT_EQ(list2[3], 4);
+
+  sc::small_vector<int, 2> list3;
+  list3 = std::move(list1);
+  EXPECT_EQ(list3.size(), 4);
+  EXPECT_TRUE(list1.empty());
+
+  list3 = {7, 8};
+  EXPECT_EQ(list3.size(), 2);
+  EXPECT_EQ(list3[1], 8);
+}
+
+TEST(SpecialFunctions, Allocator) {
+  // Every heap allocation must come from the buffer, since the upstream
+  // resource throws on any request.
+  char buffer[4096];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  sc::pmr::small_vector<int, 4> list1(&arena);
+  for (int counter{0}; counter < 100; ++counter) {
+    list1.push_back(counter);
+  }
+  EXPECT_FALSE(list1.is_inline());
+  EXPECT_EQ(list1.get_allocator().resource(), &arena);
+  EXPECT_GE(reinterpret_cast<char *>(list1.data()), buffer);
+  EXPECT_LT(reinterpret_cast<char *>(list1.data()), buffer + sizeof(buffer));
+
+  // The elements get the allocator of the container too, inline or not.
+  sc::pmr::small_vector<std::pmr::string, 2> list2(&arena);
+  list2.emplace_back("a string too long for the small string optimization");
+  EXPECT_TRUE(list2.is_inline());
+  EXPECT_EQ(list2[0].get_allocator().resource(), &arena);
+
+  // Copies use the default resource, unless an allocator is given.
+  sc::pmr::small_vector<int, 4> list3(list1);
+  EXPECT_EQ(list3.get_allocator().resource(),
+            std::pmr::get_default_resource());
+  sc::pmr::small_vector<int, 4> list4(list1, &arena);
+  EXPECT_EQ(list4.get_allocator().resource(), &arena);
+  EXPECT_EQ(list4[99], 99);
+
+  // Moving to another resource moves the elements one by one.
+  sc::pmr::small_vector<int, 4> list5(std::move(list3), &arena);
+  EXPECT_NE(list5.data(), list3.data());
+  EXPECT_EQ(list5[50], 50);
+  EXPECT_TRUE(list3.empty());
+
+  // Polymorphic allocators do not propagate on assignment.
+  sc::pmr::small_vector<int, 4> list6{1, 2, 3, 4, 5};
+  list5 = std::move(list6);
+  EXPECT_EQ(list5.get_allocator().resource(), &arena);
+  EXPECT_EQ(list5.size(), 5);
+  EXPECT_EQ(list5[4], 5);
+}
+
+TEST(Capacity, reserve) {
+  sc::small_vector<int, 4> list1{1, 2, 3};
+  list1.reserve(3);
+  EXPECT_TRUE(list1.is_inline());
+  list1.reserve(10);
+  EXPECT_FALSE(list1.is_inline());
+  EXPECT_EQ(list1.capacity(), 10);
+  EXPECT_EQ(list1[2], 3);
+}
+
+TEST(Capacity, shrink_to_fit) {
+  sc::small_vector<std::string, 4> list1;
+  for (int counter{0}; counter < 10; ++counter) {
+    list1.push_back(std::to_string(counter));
+  }
+  EXPECT_FALSE(list1.is_inline());
+  list1.shrink_to_fit();
+  EXPECT_EQ(list1.capacity(), 10);
+  list1.resize(3);
+  list1.shrink_to_fit();
+  EXPECT_TRUE(list1.is_inline());
+  EXPECT_EQ(list1.capacity(), 4);
+  EXPECT_EQ(list1[2], "2");
+}
+
+TEST(Modifiers, push_back) {
+  sc::small_vector<int, 4> list1;
+  for (int counter{0}; counter < 4; ++counter) {
+    list1.push_back(counter);
+  }
+  EXPECT_TRUE(list1.is_inline());
+  list1.push_back(list1[0]);
+  EXPECT_FALSE(list1.is_inline());
+  for (int counter{0}; counter < 4; ++counter) {
+    EXPECT_EQ(list1[counter], counter);
+  }
+  EXPECT_EQ(list1.back(), 0);
+}
+
+TEST(Modifiers, insert) {
+  sc::small_vector<int, 4> list1{1, 5};
+  list1.insert(list1.begin() + 1, {2, 3, 4});
+  EXPECT_EQ(list1.size(), 5);
+  for (int counter{0}; counter < 5; ++counter) {
+    EXPECT_EQ(list1[counter], counter + 1);
+  }
+  list1.insert(list1.begin(), static_cast<size_t>(2), 0);
+  EXPECT_EQ(list1.size(), 7);
+  EXPECT_EQ(list1[1], 0);
+  EXPECT_EQ(list1[2], 1);
+}
+
+TEST(Modifiers, erase) {
+  sc::small_vector<std::string, 2> list1{"a", "b", "c", "d"};
+  auto it = list1.erase(list1.begin() + 1);
+  EXPECT_EQ(*it, "c");
+  EXPECT_EQ(list1.size(), 3);
+  list1.erase(list1.begin(), list1.begin() + 2);
+  EXPECT_EQ(list1.size(), 1);
+  EXPECT_EQ(list1[0], "d");
+}
+
+TEST(Modifiers, emplace) {
+  sc::small_vector<std::pair<int, std::string>, 2> list1;
+  list1.emplace_back(1, "one");
+  list1.emplace(list1.begin(), 0, "zero");
+  list1.emplace(list1.end(), 2, "two");
+  EXPECT_EQ(list1.size(), 3);
+  EXPECT_EQ(list1[0].second, "zero");
+  EXPECT_EQ(list1[2].second, "two");
+}
+
+TEST(Modifiers, ResizeWithOwnElement) {
+  const std::string value(40, 'a');
+  sc::small_vector<std::string, 2> list1{value, value};
+  // The element filled in must survive the move to the heap.
+  list1.resize(50, list1[0]);
+  ASSERT_EQ(list1.size(), 50);
+  for (const auto &element : list1) {
+    EXPECT_EQ(element, value);
+  }
+}
+
+TEST(Modifiers, InsertCopiesOfOwnElement) {
+  const std::string value(40, 'a');
+  sc::small_vector<std::string, 2> list1{value, "b"};
+  // Moving to the heap: the copies must not be made from the inline buffer.
+  list1.insert(list1.begin(), 2, list1[0]);
+  ASSERT_EQ(list1.size(), 4);
+  EXPECT_FALSE(list1.is_inline());
+  for (size_t index{0}; index < 3; ++index) {
+    EXPECT_EQ(list1[index], value);
+  }
+  EXPECT_EQ(list1[3], "b");
+
+  // Not reallocating: the copies must not be made from a shifted element.
+  list1.reserve(16);
+  list1.insert(list1.begin(), 2, list1[3]);
+  ASSERT_EQ(list1.size(), 6);
+  EXPECT_EQ(list1[0], "b");
+  EXPECT_EQ(list1[1], "b");
+  for (size_t index{2}; index < 5; ++index) {
+    EXPECT_EQ(list1[index], value);
+  }
+  EXPECT_EQ(list1[5], "b");
+}
+
+TEST(Modifiers, pop_back) {
+  sc::small_vector<std::string, 2> list1{"a", "b", "c"};
+  list1.pop_back();
+  ASSERT_EQ(list1.size(), 2);
+  EXPECT_EQ(list1.back(), "b");
+  list1.pop_back();
+  list1.pop_back();
+  EXPECT_TRUE(list1.empty());
+}
+
+TEST(Modifiers, append_uninitialized) {
+  sc::small_vector<int, 4> list1{0, 1};
+  list1.append_uninitialized(6, [](int *storage) {
+    for (int index{0}; index < 6; ++index) {
+      new (storage + index) int(index + 2);
+    }
+  });
+  ASSERT_EQ(list1.size(), 8);
+  EXPECT_FALSE(list1.is_inline());
+  for (int counter{0}; counter < 8; ++counter) {
+    EXPECT_EQ(list1[counter], counter);
+  }
+}
+
+TEST(Modifiers, swap) {
+  sc::small_vector<std::string, 2> inline1{"a"};
+  sc::small_vector<std::string, 2> inline2{"b", "c"};
+  sc::small_vector<std::string, 2> heap1{"d", "e", "f"};
+  sc::small_vector<std::string, 2> heap2{"g", "h", "i", "j"};
+  const std::string *heap_data = heap2.data();
+
+  // Inline with inline, inline with heap and heap with heap.
+  inline1.swap(inline2);
+  ASSERT_EQ(inline1.size(), 2);
+  EXPECT_EQ(inline1[1], "c");
+  ASSERT_EQ(inline2.size(), 1);
+  EXPECT_EQ(inline2[0], "a");
+  swap(inline1, heap1);
+  ASSERT_EQ(inline1.size(), 3);
+  EXPECT_FALSE(inline1.is_inline());
+  EXPECT_EQ(inline1[2], "f");
+  ASSERT_EQ(heap1.size(), 2);
+  EXPECT_TRUE(heap1.is_inline());
+  EXPECT_EQ(heap1[0], "b");
+  inline1.swap(heap2);
+  EXPECT_EQ(inline1.data(), heap_data);
+  EXPECT_EQ(inline1[3], "j");
+  ASSERT_EQ(heap2.size(), 3);
+  EXPECT_EQ(heap2[0], "d");
+}
+
+TEST(Modifiers, push_front) {
+  sc::small_vector<int, 4> list1;
+  for (int counter{0}; counter < 6; ++counter) {
+    list1.push_front(counter);
+  }
+  for (int counter{0}; counter < 6; ++counter) {
+    EXPECT_EQ(list1[counter], 5 - counter);
+  }
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,174 @@
+#include "Vector/SoaVector.h"
+#include "gtest/gtest.h"
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/*
+ * There is no soa_vector in "std", so the tests use the "sc" namespace
+ * directly.
+ */
+
+/// Field whose constructor throws when given a negative number.
+struct NonNegative {
+  explicit NonNegative(int number) : value{number} {
+    if (number < 0) {
+      throw std::invalid_argument("negative number");
+    }
+  }
+  int value;
+};
+
+/// Field whose copy constructor throws once "copies_left" reaches zero.
+struct CopyLimited {
+  explicit CopyLimited(int number) : value{number} {}
+  CopyLimited(const CopyLimited &other) : value{other.value} {
+    if (copies_left-- == 0) {
+      throw std::runtime_error("no copies left");
+    }
+  }
+  CopyLimited(CopyLimited &&) noexcept = default;
+  int value;
+  static inline int copies_left{0};
+};
+
+TEST(SpecialFunctions, DefaultConstructor) {
+  sc::soa_vector<int, double> list1;
+  EXPECT_TRUE(list1.empty());
+  EXPECT_EQ(list1.size(), 0);
+
+  sc::soa_vector<int, std::string> list2(3, {7, "seven"});
+  EXPECT_EQ(list2.size(), 3);
+  EXPECT_EQ(std::get<0>(list2[2]), 7);
+  EXPECT_EQ(std::get<1>(list2[2]), "seven");
+}
+
+TEST(SpecialFunctions, InitializerListConstructor) {
+  sc::soa_vector<int, char> list1{{1, 'a'}, {2, 'b'}, {3, 'c'}};
+  EXPECT_EQ(list1.size(), 3);
+  EXPECT_EQ(list1[1], std::make_tuple(2, 'b'));
+}
+
+TEST(ElementAccess, Records) {
+  sc::soa_vector<int, std::string> list1{{1, "one"}, {2, "two"}};
+  std::get<1>(list1[0]) = "uno";
+  EXPECT_EQ(std::get<1>(list1.front()), "uno");
+  EXPECT_EQ(std::get<0>(list1.back()), 2);
+  const auto &list2 = list1;
+  EXPECT_EQ(std::get<1>(list2[1]), "two");
+}
+
+TEST(ElementAccess, column) {
+  sc::soa_vector<int, double, char> list1;
+  for (int counter{0}; counter < 100; ++counter) {
+    list1.push_back({counter, counter / 2.0, 'x'});
+  }
+  auto ids = list1.column<0>();
+  EXPECT_EQ(ids.size(), 100);
+  EXPECT_EQ(std::accumulate(ids.begin(), ids.end(), 0), 4950);
+  ids[10] = -1;
+  EXPECT_EQ(std::get<0>(list1[10]), -1);
+
+  const auto &list2 = list1;
+  auto halves = list2.column<1>();
+  EXPECT_EQ(halves[99], 49.5);
+  EXPECT_EQ(halves.data() + 1, &halves[1]);
+}
+
+TEST(Iterators, Zipped) {
+  sc::soa_vector<int, std::string> list1{{1, "a"}, {2, "b"}, {3, "c"}};
+  int expected{1};
+  for (auto [number, letter] : list1) {
+    EXPECT_EQ(number, expected);
+    letter += "!";
+    ++expected;
+  }
+  EXPECT_EQ(std::get<1>(list1[2]), "c!");
+
+  auto it = list1.begin();
+  EXPECT_EQ((it + 2).get<0>(), 3);
+  EXPECT_EQ(std::get<1>(it[1]), "b!");
+  EXPECT_EQ(list1.end() - list1.begin(), 3);
+  sc::soa_vector<int, std::string>::const_iterator cit = it;
+  EXPECT_TRUE(cit == list1.cbegin());
+  EXPECT_TRUE(++cit < list1.cend());
+
+  // The reference is a proxy, so it is only declared an input iterator.
+  using category = std::iterator_traits<decltype(it)>::iterator_category;
+  EXPECT_TRUE((std::is_same_v<category, std::input_iterator_tag>));
+  EXPECT_EQ(std::distance(list1.begin(), list1.end()), 3);
+}
+
+TEST(Modifiers, PushBackAndEmplace) {
+  sc::soa_vector<std::string, int> list1;
+  std::tuple<std::string, int> record{"moved", 1};
+  list1.push_back(std::move(record));
+  list1.emplace_back("zzz", 2);
+  EXPECT_EQ(list1.size(), 2);
+  EXPECT_EQ(std::get<0>(list1[0]), "moved");
+  EXPECT_EQ(std::get<0>(list1[1]), "zzz");
+  EXPECT_EQ(list1.column<1>()[1], 2);
+}
+
+TEST(Modifiers, EmplaceBackThrows) {
+  sc::soa_vector<std::string, NonNegative> list1;
+  const std::string name(32, 'a');
+  for (int counter{0}; counter < 20; ++counter) {
+    list1.emplace_back(name, counter);
+    // The string is already in its column when the second field throws.
+    EXPECT_THROW(list1.emplace_back(std::string(32, 'b'), -1),
+                 std::invalid_argument);
+    ASSERT_EQ(list1.size(), counter + 1);
+    ASSERT_EQ(list1.column<0>().size(), counter + 1);
+    ASSERT_EQ(list1.column<1>().size(), counter + 1);
+    EXPECT_EQ(std::get<0>(list1.back()), name);
+    EXPECT_EQ(std::get<1>(list1.back()).value, counter);
+  }
+}
+
+TEST(Modifiers, EmplaceBackOwnField) {
+  sc::soa_vector<std::string, int> list1;
+  list1.emplace_back(std::string(40, 'a'), 1);
+  list1.shrink_to_fit();
+  // The field copied must survive the growth of its column.
+  list1.emplace_back(std::get<0>(list1[0]), std::get<1>(list1[0]));
+  EXPECT_EQ(std::get<0>(list1[1]), std::string(40, 'a'));
+  EXPECT_EQ(std::get<1>(list1[1]), 1);
+}
+
+TEST(Modifiers, ResizeAndPopBack) {
+  sc::soa_vector<int, int> list1;
+  list1.reserve(10);
+  EXPECT_GE(list1.capacity(), 10);
+  list1.resize(5, {1, 2});
+  EXPECT_EQ(list1.size(), 5);
+  list1.pop_back();
+  EXPECT_EQ(list1.size(), 4);
+  EXPECT_EQ(list1.column<1>().size(), 4);
+  list1.clear();
+  EXPECT_TRUE(list1.empty());
+}
+
+TEST(Modifiers, ResizeThrows) {
+  sc::soa_vector<std::string, CopyLimited> list1;
+  list1.emplace_back("a", 1);
+  list1.emplace_back("b", 2);
+  // The strings are already resized when the copies of the second field run
+  // out.
+  CopyLimited::copies_left = 3;
+  EXPECT_THROW(list1.resize(10, {"x", CopyLimited(7)}), std::runtime_error);
+  ASSERT_EQ(list1.size(), 2);
+  ASSERT_EQ(list1.column<0>().size(), 2);
+  ASSERT_EQ(list1.column<1>().size(), 2);
+  EXPECT_EQ(std::get<0>(list1.back()), "b");
+  EXPECT_EQ(std::get<1>(list1.back()).value, 2);
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,194 @@
+#include "Vector/StableVector.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+ * There is no stable vector in "std", so the tests use the "sc" namespace
+ * directly. Most of them use chunks of 4 elements, so that a few elements
+ * already spread over several chunks.
+ */
+
+using small_chunks = sc::stable_vector<int, 4>;
+
+TEST(ChunkSize, DefaultChunkSize) {
+  EXPECT_EQ(sc::chunk_elements<char>(), 4096);
+  EXPECT_EQ(sc::chunk_elements<int>(), 1024);
+  EXPECT_EQ(sc::chunk_elements<char[3]>(), 2048);
+  EXPECT_EQ(sc::chunk_elements<char[1000]>(), 16);
+  EXPECT_EQ(sc::stable_vector<int>::chunk_size(), 1024);
+}
+
+TEST(SpecialFunctions, DefaultConstructor) {
+  small_chunks list;
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.size(), 0);
+  EXPECT_EQ(list.capacity(), 0);
+  EXPECT_EQ(list.begin(), list.end());
+}
+
+TEST(SpecialFunctions, Constructors) {
+  small_chunks list1(10, 7);
+  EXPECT_EQ(list1.size(), 10);
+  EXPECT_EQ(list1.capacity(), 12);
+  EXPECT_EQ(std::count(list1.begin(), list1.end(), 7), 10);
+
+  small_chunks list2{1, 2, 3, 4, 5, 6};
+  EXPECT_EQ(list2.size(), 6);
+  EXPECT_EQ(list2[5], 6);
+
+  small_chunks list3(list2.begin() + 1, list2.end());
+  EXPECT_EQ(list3.size(), 5);
+  EXPECT_EQ(list3.front(), 2);
+  EXPECT_EQ(list3.back(), 6);
+}
+
+TEST(SpecialFunctions, CopyAndMove) {
+  small_chunks list1{1, 2, 3, 4, 5, 6};
+  small_chunks list2(list1);
+  EXPECT_TRUE(std::equal(list1.begin(), list1.end(), list2.begin(),
+                         list2.end()));
+  list2[0] = 10;
+  EXPECT_EQ(list1[0], 1);
+
+  int *address = &list1[4];
+  small_chunks list3(std::move(list1));
+  EXPECT_TRUE(list1.empty());
+  EXPECT_EQ(list3.size(), 6);
+  // The elements were not moved, only the chunks changed of owner.
+  EXPECT_EQ(&list3[4], address);
+
+  list1 = list3;
+  EXPECT_EQ(list1.size(), 6);
+  EXPECT_EQ(list1[4], 5);
+  list2 = std::move(list3);
+  EXPECT_EQ(&list2[4], address);
+  EXPECT_TRUE(list3.empty());
+  list2 = {7, 8};
+  EXPECT_EQ(list2.size(), 2);
+  EXPECT_EQ(list2.back(), 8);
+}
+
+TEST(ElementAccess, ElementAccess) {
+  small_chunks list;
+  for (int index{0}; index < 50; ++index) {
+    list.push_back(index);
+  }
+  for (int index{0}; index < 50; ++index) {
+    EXPECT_EQ(list[index], index);
+    EXPECT_EQ(list.at(index), index);
+  }
+  EXPECT_EQ(list.front(), 0);
+  EXPECT_EQ(list.back(), 49);
+  const small_chunks &constant = list;
+  EXPECT_EQ(constant[13], 13);
+  EXPECT_EQ(constant.back(), 49);
+}
+
+TEST(Stability, ReferencesSurviveGrowth) {
+  sc::stable_vector<std::string, 8> list;
+  std::vector<std::pair<std::string *, std::string>> seen;
+  for (int index{0}; index < 1000; ++index) {
+    list.emplace_back(std::to_string(index));
+    seen.emplace_back(&list.back(), list.back());
+  }
+  for (size_t index{0}; index < seen.size(); ++index) {
+    EXPECT_EQ(seen[index].first, &list[index]);
+    EXPECT_EQ(*seen[index].first, seen[index].second);
+  }
+}
+
+TEST(Stability, IteratorsSurviveGrowth) {
+  small_chunks list{1, 2, 3};
+  auto it = list.begin() + 2;
+  for (int index{4}; index < 100; ++index) {
+    list.push_back(index);
+  }
+  EXPECT_EQ(*it, 3);
+  EXPECT_EQ(it[10], 13);
+  EXPECT_EQ(list.end() - it, 97);
+}
+
+TEST(Iterators, Iterators) {
+  small_chunks list(30, 0);
+  std::iota(list.begin(), list.end(), 0);
+  std::reverse(list.begin(), list.end());
+  EXPECT_EQ(list.front(), 29);
+  std::sort(list.begin(), list.end());
+  EXPECT_TRUE(std::is_sorted(list.cbegin(), list.cend()));
+  EXPECT_EQ(*std::find(list.begin(), list.end(), 17), 17);
+  EXPECT_EQ(*list.rbegin(), 29);
+  EXPECT_EQ(*(list.rend() - 1), 0);
+
+  small_chunks::const_iterator it = list.begin();
+  EXPECT_EQ(it, list.cbegin());
+  it += 5;
+  EXPECT_EQ(*it, 5);
+  EXPECT_TRUE(list.cbegin() < it);
+  EXPECT_EQ(*(it - 2), 3);
+  EXPECT_EQ(*(2 + it), 7);
+}
+
+TEST(Capacity, ReserveAndShrink) {
+  small_chunks list;
+  list.reserve(9);
+  EXPECT_EQ(list.capacity(), 12);
+  list.push_back(1);
+  int *address = &list[0];
+  list.reserve(100);
+  EXPECT_EQ(list.capacity(), 100);
+  EXPECT_EQ(&list[0], address);
+  list.shrink_to_fit();
+  EXPECT_EQ(list.capacity(), 4);
+  EXPECT_EQ(&list[0], address);
+  list.clear();
+  EXPECT_EQ(list.capacity(), 4);
+  list.shrink_to_fit();
+  EXPECT_EQ(list.capacity(), 0);
+}
+
+TEST(Modifiers, PushAndPop) {
+  small_chunks list;
+  for (int index{0}; index < 9; ++index) {
+    list.push_back(index);
+  }
+  EXPECT_EQ(list.size(), 9);
+  EXPECT_EQ(list.capacity(), 12);
+  list.pop_back();
+  list.pop_back();
+  EXPECT_EQ(list.size(), 7);
+  EXPECT_EQ(list.back(), 6);
+  EXPECT_EQ(list.capacity(), 12);
+  EXPECT_EQ(list.emplace_back(20), 20);
+  EXPECT_EQ(list[7], 20);
+}
+
+TEST(Modifiers, ResizeAndSwap) {
+  sc::stable_vector<std::unique_ptr<int>, 4> list1;
+  list1.emplace_back(new int(5));
+  list1.push_back(std::make_unique<int>(6));
+  EXPECT_EQ(*list1[1], 6);
+
+  small_chunks list2{1, 2, 3};
+  list2.resize(10, 4);
+  EXPECT_EQ(list2.size(), 10);
+  EXPECT_EQ(list2[9], 4);
+  list2.resize(2);
+  EXPECT_EQ(list2.size(), 2);
+  EXPECT_EQ(list2.back(), 2);
+
+  small_chunks list3{7};
+  swap(list2, list3);
+  EXPECT_EQ(list2.size(), 1);
+  EXPECT_EQ(list3.size(), 2);
+  EXPECT_EQ(list2[0], 7);
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -1,14 +1,24 @@
 #include "Vector/Vector.h"
 #include "gtest/gtest.h"
+#include <algorithm>
 #include <initializer_list>
+#include <iterator>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 /*
  * The "lib" macro can be used to select which lib to test. To ensure the
  * integrity of the tests, the "std" namespace must be used, to effectively test
- * the vector developed the "sc" namespace must be used. Note: the test for the
- * function "push_front" does not use the "lib" macro, because it is not defined
- * in "std", instead the namespace "sc" is used directly.
+ * the vector developed the "sc" namespace must be used. Note: the tests for the
+ * functions "push_front" and "append_uninitialized" do not use the "lib" macro,
+ * because they are not defined in "std", instead the namespace "sc" is used
+ * directly. Neither does the test of the strong exception guarantee of insert,
+ * which "std" only gives when inserting at the end.
  */
 #define lib sc
 // #define lib std
@@ -58,6 +68,40 @@ TEST(SpecialFunctions, CopyConstructor) {
   EXPECT_EQ(list2.capacity(), 5);
 }
 
+TEST(SpecialFunctions, MoveConstructor) {
+  static_assert(std::is_nothrow_move_constructible_v<lib::vector<int>>);
+  lib::vector<std::string> list1{"a", "b", "c"};
+  const std::string *array = list1.data();
+  lib::vector<std::string> list2(std::move(list1));
+  EXPECT_EQ(list2.data(), array);
+  EXPECT_EQ(list2.size(), 3);
+  EXPECT_EQ(list2[2], "c");
+  EXPECT_TRUE(list1.empty());
+}
+
+TEST(SpecialFunctions, CopyAssignment) {
+  lib::vector<std::string> list1{"a", "b", "c"};
+  lib::vector<std::string> list2{"d"};
+  list2 = list1;
+  EXPECT_EQ(list2.size(), 3);
+  EXPECT_EQ(list2[0], "a");
+  EXPECT_NE(list2.data(), list1.data());
+  list2 = list2;
+  EXPECT_EQ(list2.size(), 3);
+}
+
+TEST(SpecialFunctions, MoveAssignment) {
+  static_assert(std::is_nothrow_move_assignable_v<lib::vector<int>>);
+  lib::vector<std::string> list1{"a", "b", "c"};
+  lib::vector<std::string> list2{"d"};
+  const std::string *array = list1.data();
+  list2 = std::move(list1);
+  EXPECT_EQ(list2.data(), array);
+  EXPECT_EQ(list2.size(), 3);
+  EXPECT_EQ(list2[1], "b");
+  EXPECT_TRUE(list1.empty());
+}
+
 TEST(SpecialFunctions, AssignRange) {
   int array[] = {1, 2, 3, 4, 5};
   lib::vector<int> list1;
@@ -79,6 +123,49 @@ TEST(SpecialFunctions, RangeConstructor) {
   EXPECT_EQ(list1.capacity(), 5);
 }
 
+TEST(SpecialFunctions, Allocator) {
+  // Every allocation must come from the buffer, since the upstream resource
+  // throws on any request.
+  char buffer[4096];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  sc::pmr::vector<int> list1(&arena);
+  for (int counter{0}; counter < 100; ++counter) {
+    list1.push_back(counter);
+  }
+  list1.shrink_to_fit();
+  EXPECT_EQ(list1.get_allocator().resource(), &arena);
+  EXPECT_GE(reinterpret_cast<char *>(list1.data()), buffer);
+  EXPECT_LT(reinterpret_cast<char *>(list1.data()), buffer + sizeof(buffer));
+
+  // The elements get the allocator of the container too.
+  sc::pmr::vector<std::pmr::string> list2(&arena);
+  list2.emplace_back("a string too long for the small string optimization");
+  EXPECT_EQ(list2[0].get_allocator().resource(), &arena);
+
+  // Copies use the default resource, unless an allocator is given.
+  sc::pmr::vector<int> list3(list1);
+  EXPECT_EQ(list3.get_allocator().resource(),
+            std::pmr::get_default_resource());
+  sc::pmr::vector<int> list4(list1, &arena);
+  EXPECT_EQ(list4.get_allocator().resource(), &arena);
+  EXPECT_EQ(list4.size(), 100);
+  EXPECT_EQ(list4[99], 99);
+
+  // Moving to another resource moves the elements one by one.
+  sc::pmr::vector<int> list5(std::move(list3), &arena);
+  EXPECT_EQ(list5.size(), 100);
+  EXPECT_EQ(list5[50], 50);
+  EXPECT_TRUE(list3.empty());
+
+  // Polymorphic allocators do not propagate on assignment.
+  sc::pmr::vector<int> list6{1, 2, 3};
+  list5 = std::move(list6);
+  EXPECT_EQ(list5.get_allocator().resource(), &arena);
+  EXPECT_EQ(list5.size(), 3);
+  EXPECT_EQ(list5[2], 3);
+}
+
 TEST(ElementAccess, front) {
   lib::vector<int> list1{100, 200, 300, 400};
   EXPECT_EQ(list1.front(), 100);
@@ -210,6 +297,66 @@ TEST(Iterators, DifferenceOperator) {
   EXPECT_TRUE(list1.end() != list1.end() + 1);
 }
 
+TEST(Iterators, Traits) {
+  using iterator = lib::vector<int>::iterator;
+  using const_iterator = lib::vector<int>::const_iterator;
+  static_assert(
+      std::is_same_v<std::iterator_traits<iterator>::iterator_category,
+                     std::random_access_iterator_tag>);
+  static_assert(
+      std::is_same_v<std::iterator_traits<const_iterator>::reference,
+                     const int &>);
+  static_assert(std::is_convertible_v<iterator, const_iterator>);
+  static_assert(!std::is_convertible_v<const_iterator, iterator>);
+
+  lib::vector<int> list1{1, 2, 3};
+  const_iterator it = list1.begin();
+  EXPECT_TRUE(it == list1.begin());
+  EXPECT_TRUE(it < list1.end());
+  EXPECT_EQ(list1.end() - it, 3);
+  EXPECT_EQ(it[2], 3);
+  it += 2;
+  EXPECT_EQ(*it, 3);
+  it -= 1;
+  EXPECT_EQ(*it, 2);
+}
+
+TEST(Iterators, ConstIterators) {
+  const lib::vector<int> list1{1, 2, 3, 4};
+  int expected{1};
+  for (int value : list1) {
+    EXPECT_EQ(value, expected++);
+  }
+  EXPECT_EQ(list1.cend() - list1.cbegin(), 4);
+  EXPECT_EQ(*list1.begin(), 1);
+}
+
+TEST(Iterators, ReverseIterators) {
+  lib::vector<int> list1{1, 2, 3, 4};
+  int expected{4};
+  for (auto it = list1.rbegin(); it != list1.rend(); ++it) {
+    EXPECT_EQ(*it, expected--);
+  }
+  *list1.rbegin() = 99;
+  EXPECT_EQ(list1.back(), 99);
+  EXPECT_EQ(*list1.crbegin(), 99);
+  EXPECT_EQ(list1.crend() - list1.crbegin(), 4);
+}
+
+TEST(Iterators, Algorithms) {
+  lib::vector<int> list1{5, 3, 1, 4, 2};
+  std::sort(list1.begin(), list1.end());
+  EXPECT_TRUE(std::is_sorted(list1.cbegin(), list1.cend()));
+  EXPECT_EQ(std::lower_bound(list1.begin(), list1.end(), 4) - list1.begin(), 3);
+
+  lib::vector<int> list2(5, 0);
+  std::copy(list1.cbegin(), list1.cend(), list2.begin());
+  EXPECT_EQ(list2[4], 5);
+  list2.erase(list2.cbegin() + 1, list2.cend() - 1);
+  EXPECT_EQ(list2.size(), 2);
+  EXPECT_EQ(list2[1], 5);
+}
+
 TEST(Capacity, empty) {
   lib::vector<int> list1{1, 2, 3};
   EXPECT_FALSE(list1.empty());
@@ -256,6 +403,68 @@ TEST(Capacity, shrink_to_fit) {
   EXPECT_EQ(list1.capacity(), 6);
 }
 
+TEST(Capacity, ReserveKeepsElements) {
+  lib::vector<std::string> list1;
+  for (int counter{0}; counter < 20; ++counter) {
+    list1.push_back(std::string(32, 'a' + counter));
+  }
+  list1.reserve(100);
+  EXPECT_EQ(list1.capacity(), 100);
+  list1.shrink_to_fit();
+  EXPECT_EQ(list1.capacity(), 20);
+  for (int counter{0}; counter < 20; ++counter) {
+    EXPECT_EQ(list1[counter], std::string(32, 'a' + counter));
+  }
+}
+
+TEST(Capacity, ReserveDoesNotConstruct) {
+  struct NoDefault {
+    explicit NoDefault(int number) : value(number) {}
+    int value;
+  };
+  lib::vector<NoDefault> list1;
+  list1.reserve(10);
+  EXPECT_TRUE(list1.empty());
+  for (int counter{0}; counter < 20; ++counter) {
+    list1.push_back(NoDefault(counter));
+  }
+  for (int counter{0}; counter < 20; ++counter) {
+    EXPECT_EQ(list1[counter].value, counter);
+  }
+}
+
+TEST(Capacity, GrowthPolicy) {
+  sc::vector<int> list1;
+  size_t reallocations{0}, capacity{0};
+  for (int counter{0}; counter < 1000; ++counter) {
+    list1.insert(list1.end(), static_cast<size_t>(3), counter);
+    if (list1.capacity() != capacity) {
+      capacity = list1.capacity();
+      ++reallocations;
+    }
+  }
+  EXPECT_EQ(list1.size(), 3000);
+  EXPECT_LE(reallocations, 12);
+
+  sc::vector<int, sc::growth::OneAndHalf<int>> list2;
+  std::vector<size_t> capacities;
+  for (int counter{0}; counter < 10; ++counter) {
+    list2.push_back(counter);
+    if (capacities.empty() || capacities.back() != list2.capacity()) {
+      capacities.push_back(list2.capacity());
+    }
+  }
+  EXPECT_EQ(capacities, std::vector<size_t>({1, 2, 3, 4, 6, 9, 13}));
+
+  sc::vector<int, sc::growth::PageAligned<int>> list3;
+  for (int counter{0}; counter < 5000; ++counter) {
+    list3.push_back(counter);
+    if (list3.capacity() * sizeof(int) > 4096) {
+      EXPECT_EQ(list3.capacity() * sizeof(int) % 4096, 0);
+    }
+  }
+}
+
 TEST(Modifiers, clear) {
   lib::vector<int> list1{1, 2, 3};
   EXPECT_FALSE(list1.begin() == list1.end());
@@ -377,6 +586,107 @@ TEST(Modifiers, EraseRange) {
   EXPECT_EQ(list2.size(), 6);
 }
 
+TEST(Modifiers, ShiftNonTrivial) {
+  // Inserting fewer elements than the ones after the position, and more.
+  lib::vector<std::string> list1{"a", "d", "e", "f"};
+  list1.reserve(16);
+  list1.insert(list1.begin() + 1, {"b", "c"});
+  list1.insert(list1.begin() + 5, static_cast<size_t>(3), "x");
+  std::vector<std::string> expected{"a", "b", "c", "d", "e",
+                                    "x", "x", "x", "f"};
+  ASSERT_EQ(list1.size(), expected.size());
+  for (size_t index{0}; index < expected.size(); ++index) {
+    EXPECT_EQ(list1[index], expected[index]);
+  }
+
+  list1.erase(list1.begin() + 5, list1.begin() + 8);
+  list1.erase(list1.begin());
+  expected = {"b", "c", "d", "e", "f"};
+  ASSERT_EQ(list1.size(), expected.size());
+  for (size_t index{0}; index < expected.size(); ++index) {
+    EXPECT_EQ(list1[index], expected[index]);
+  }
+}
+
+TEST(Modifiers, InsertCopiesOfOwnElement) {
+  const std::string value(40, 'a');
+  lib::vector<std::string> list1{value, "b"};
+  list1.shrink_to_fit();
+  // Reallocating: the copies must not be made from the old buffer.
+  list1.insert(list1.begin(), 2, list1[0]);
+  ASSERT_EQ(list1.size(), 4);
+  for (size_t index{0}; index < 3; ++index) {
+    EXPECT_EQ(list1[index], value);
+  }
+  EXPECT_EQ(list1[3], "b");
+
+  // Not reallocating: the copies must not be made from a shifted element.
+  list1.reserve(16);
+  list1.insert(list1.begin(), 2, list1[3]);
+  ASSERT_EQ(list1.size(), 6);
+  EXPECT_EQ(list1[0], "b");
+  EXPECT_EQ(list1[1], "b");
+  for (size_t index{2}; index < 5; ++index) {
+    EXPECT_EQ(list1[index], value);
+  }
+  EXPECT_EQ(list1[5], "b");
+}
+
+TEST(Modifiers, InsertThrowingCopy) {
+  int copies_left{0};
+  struct Throwing {
+    Throwing(int data, int *counter)
+        : value{std::to_string(data)}, copies_left{counter} {}
+    Throwing(const Throwing &other)
+        : value{other.value}, copies_left{other.copies_left} {
+      if ((*copies_left)-- == 0) {
+        throw std::runtime_error("copy");
+      }
+    }
+    Throwing(Throwing &&) noexcept = default;
+    Throwing &operator=(const Throwing &) = default;
+    Throwing &operator=(Throwing &&) noexcept = default;
+    std::string value;
+    int *copies_left;
+  };
+  sc::vector<Throwing> list1;
+  list1.reserve(8);
+  for (int index{0}; index < 4; ++index) {
+    list1.emplace_back(index, &copies_left);
+  }
+  // The second of three copies throws, with more elements after the position
+  // than copies and with fewer.
+  for (size_t pos_index : {0, 3}) {
+    copies_left = 2;
+    EXPECT_THROW(
+        list1.insert(list1.begin() + pos_index, 3, Throwing(9, &copies_left)),
+        std::runtime_error);
+    ASSERT_EQ(list1.size(), 4);
+    for (size_t index{0}; index < 4; ++index) {
+      EXPECT_EQ(list1[index].value, std::to_string(index));
+    }
+  }
+}
+
+TEST(Modifiers, GrowWithThrowingMove) {
+  // Moving could throw halfway through a growth, so the elements are copied.
+  struct ThrowingMove {
+    explicit ThrowingMove(int data) : value{data} {}
+    ThrowingMove(const ThrowingMove &) = default;
+    ThrowingMove(ThrowingMove &&) { throw std::runtime_error("move"); }
+    int value;
+  };
+  lib::vector<ThrowingMove> list1;
+  for (int index{0}; index < 100; ++index) {
+    const ThrowingMove element(index);
+    list1.push_back(element);
+  }
+  ASSERT_EQ(list1.size(), 100);
+  for (size_t index{0}; index < list1.size(); ++index) {
+    EXPECT_EQ(list1[index].value, index);
+  }
+}
+
 TEST(Modifiers, resize) {
   lib::vector<int> list1;
   EXPECT_EQ(list1.size(), 0);
@@ -388,6 +698,18 @@ TEST(Modifiers, resize) {
   EXPECT_EQ(list1.size(), 3);
 }
 
+TEST(Modifiers, ResizeWithOwnElement) {
+  const std::string value(40, 'a');
+  lib::vector<std::string> list1(1, value);
+  list1.shrink_to_fit();
+  // The element filled in must survive the reallocation.
+  list1.resize(50, list1[0]);
+  ASSERT_EQ(list1.size(), 50);
+  for (const auto &element : list1) {
+    EXPECT_EQ(element, value);
+  }
+}
+
 TEST(Modifiers, push_back) {
   lib::vector<int> list1;
   for (int counter{0}; counter < 5; ++counter) {
@@ -397,6 +719,75 @@ TEST(Modifiers, push_back) {
   }
 }
 
+TEST(Modifiers, PushBackRvalue) {
+  lib::vector<std::string> list1;
+  for (int counter{0}; counter < 10; ++counter) {
+    std::string value(32, 'a' + counter);
+    list1.push_back(std::move(value));
+    EXPECT_EQ(list1.back(), std::string(32, 'a' + counter));
+  }
+  EXPECT_EQ(list1.size(), 10);
+}
+
+TEST(Modifiers, pop_back) {
+  lib::vector<std::string> list1{"a", "b", "c"};
+  list1.pop_back();
+  EXPECT_EQ(list1.size(), 2);
+  EXPECT_EQ(list1.back(), "b");
+  EXPECT_EQ(list1.capacity(), 3);
+  list1.push_back("d");
+  EXPECT_EQ(list1.back(), "d");
+  list1.pop_back();
+  list1.pop_back();
+  list1.pop_back();
+  EXPECT_TRUE(list1.empty());
+}
+
+TEST(Modifiers, emplace_back) {
+  lib::vector<std::pair<int, std::string>> list1;
+  for (int counter{0}; counter < 10; ++counter) {
+    auto &inserted = list1.emplace_back(counter, "value");
+    EXPECT_EQ(inserted.first, counter);
+    EXPECT_EQ(list1.back().second, "value");
+  }
+  EXPECT_EQ(list1.size(), 10);
+
+  lib::vector<std::string> list2{"self"};
+  for (int counter{0}; counter < 10; ++counter) {
+    list2.emplace_back(list2.front());
+  }
+  for (const std::string &value : list2) {
+    EXPECT_EQ(value, "self");
+  }
+}
+
+TEST(Modifiers, emplace) {
+  lib::vector<std::string> list1{"a", "c"};
+  auto it = list1.emplace(list1.begin() + 1, 1, 'b');
+  EXPECT_EQ(*it, "b");
+  list1.emplace(list1.end(), "d");
+  list1.emplace(list1.begin(), list1.back());
+  ASSERT_EQ(list1.size(), 5);
+  EXPECT_EQ(list1[0], "d");
+  EXPECT_EQ(list1[1], "a");
+  EXPECT_EQ(list1[2], "b");
+  EXPECT_EQ(list1[3], "c");
+  EXPECT_EQ(list1[4], "d");
+}
+
+TEST(Modifiers, swap) {
+  lib::vector<int> list1{1, 2, 3};
+  lib::vector<int> list2{4};
+  const int *array1 = list1.data(), *array2 = list2.data();
+  list1.swap(list2);
+  EXPECT_EQ(list1.data(), array2);
+  EXPECT_EQ(list1.size(), 1);
+  swap(list1, list2);
+  EXPECT_EQ(list1.data(), array1);
+  EXPECT_EQ(list1.size(), 3);
+  EXPECT_EQ(list2[0], 4);
+}
+
 TEST(Modifiers, push_front) {
   sc::vector<int> list1;
   for (int counter{0}; counter < 5; ++counter) {
@@ -406,6 +797,23 @@ TEST(Modifiers, push_front) {
   }
 }
 
+TEST(Modifiers, append_uninitialized) {
+  sc::vector<std::string> list1{"a"};
+  list1.append_uninitialized(3, [](std::string *storage) {
+    for (int counter{0}; counter < 3; ++counter) {
+      new (storage + counter) std::string(1, 'b' + counter);
+    }
+  });
+  EXPECT_EQ(list1.size(), 4);
+  EXPECT_EQ(list1[0], "a");
+  EXPECT_EQ(list1[3], "d");
+
+  EXPECT_THROW(list1.append_uninitialized(
+                   2, [](std::string *) { throw std::runtime_error(""); }),
+               std::runtime_error);
+  EXPECT_EQ(list1.size(), 4);
+}
+
 int main(int argc, char *argv[]) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();